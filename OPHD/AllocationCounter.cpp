@@ -0,0 +1,72 @@
+#include "AllocationCounter.h"
+
+#ifdef OPHD_COUNT_ALLOCATIONS
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+namespace
+{
+	std::atomic<std::size_t> allocations{0};
+
+
+	void* countedAllocate(std::size_t size)
+	{
+		allocations.fetch_add(1, std::memory_order_relaxed);
+		if (void* memory = std::malloc(size == 0 ? 1 : size)) { return memory; }
+		throw std::bad_alloc();
+	}
+}
+
+
+std::size_t allocationCount()
+{
+	return allocations.load(std::memory_order_relaxed);
+}
+
+
+void* operator new(std::size_t size)
+{
+	return countedAllocate(size);
+}
+
+
+void* operator new[](std::size_t size)
+{
+	return countedAllocate(size);
+}
+
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+
+void operator delete[](void* memory) noexcept
+{
+	std::free(memory);
+}
+
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+#else
+
+std::size_t allocationCount()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+
+
+/**
+ * Number of calls to the global operator new and operator new[] since
+ * the program started.
+ *
+ * \note	Only counted when built with OPHD_COUNT_ALLOCATIONS defined, which
+ *			replaces the global allocation functions. Otherwise always 0.
+ */
+std::size_t allocationCount();
@@ -174,29 +174,24 @@ const std::array<NAS2D::Rectangle<int>, 4> ResourceImageRectsOre =
 };
 
 
-const std::map<std::array<bool, 4>, std::string> IntersectionPatternTable =
+const std::array<std::string, 16> IntersectionPatternTable =
 {
-	{{true, false, true, false}, "left"},
-	{{true, false, false, false}, "left"},
-	{{false, false, true, false}, "left"},
-
-	{{false, true, false, true}, "right"},
-	{{false, true, false, false}, "right"},
-	{{false, false, false, true}, "right"},
-
-	{{false, false, false, false}, "intersection"},
-	{{true, true, false, false}, "intersection"},
-	{{false, false, true, true}, "intersection"},
-	{{false, true, true, true}, "intersection"},
-	{{true, true, true, false}, "intersection"},
-	{{true, true, true, true}, "intersection"},
-	{{true, false, false, true}, "intersection"},
-	{{false, true, true, false}, "intersection"},
-
-	{{false, true, true, true}, "intersection"},
-	{{true, false, true, true}, "intersection"},
-	{{true, true, false, true}, "intersection"},
-	{{true, true, true, false}, "intersection"}
+	"intersection", // none
+	"left", // N
+	"right", // E
+	"intersection", // N E
+	"left", // S
+	"left", // N S
+	"intersection", // E S
+	"intersection", // N E S
+	"right", // W
+	"intersection", // N W
+	"right", // E W
+	"intersection", // N E W
+	"intersection", // S W
+	"intersection", // N S W
+	"intersection", // E S W
+	"intersection" // N E S W
 };
 
 
@@ -284,50 +279,17 @@ void drawProgressBar(int value, int max, NAS2D::Rectangle<int> rect, int padding
 
 int getTruckAvailability()
 {
-	int trucksAvailable = 0;
-
-	auto& warehouseList = NAS2D::Utility<StructureManager>::get().getStructures<Warehouse>();
-	for (auto warehouse : warehouseList)
-	{
-		trucksAvailable += warehouse->products().count(ProductType::PRODUCT_TRUCK);
-	}
-
-	return trucksAvailable;
+	return NAS2D::Utility<StructureManager>::get().warehouseInventory().count(ProductType::PRODUCT_TRUCK);
 }
 
 
 int pullTruckFromInventory()
 {
-	int trucksAvailable = getTruckAvailability();
-
-	if (trucksAvailable == 0) { return 0; }
-
-	auto& warehouseList = NAS2D::Utility<StructureManager>::get().getStructures<Warehouse>();
-	for (auto warehouse : warehouseList)
-	{
-		if (warehouse->products().pull(ProductType::PRODUCT_TRUCK, 1) > 0)
-		{
-			return 1;
-		}
-	}
-
-	return 0;
+	return NAS2D::Utility<StructureManager>::get().warehouseInventory().pull(ProductType::PRODUCT_TRUCK, 1);
 }
 
 
 int pushTruckIntoInventory()
 {
-	const int storageNeededForTruck = storageRequiredPerUnit(ProductType::PRODUCT_TRUCK);
-
-	auto& warehouseList = NAS2D::Utility<StructureManager>::get().getStructures<Warehouse>();
-	for (auto warehouse : warehouseList)
-	{
-		if (warehouse->products().availableStorage() >= storageNeededForTruck)
-		{
-			warehouse->products().store(ProductType::PRODUCT_TRUCK, 1);
-			return 1;
-		}
-	}
-
-	return 0;
+	return NAS2D::Utility<StructureManager>::get().warehouseInventory().store(ProductType::PRODUCT_TRUCK, 1) ? 1 : 0;
 }
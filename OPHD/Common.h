@@ -308,7 +308,7 @@ extern const std::array<std::string, 4> ResourceNamesOre;
 extern const std::array<NAS2D::Rectangle<int>, 4> ResourceImageRectsRefined;
 extern const std::array<NAS2D::Rectangle<int>, 4> ResourceImageRectsOre;
 
-extern const std::map<std::array<bool, 4>, std::string> IntersectionPatternTable;
+extern const std::array<std::string, 16> IntersectionPatternTable; /**< Road animations indexed by neighbour mask (bit \c i for \c DirectionClockwise4[i]). */
 
 void checkSavegameVersion(const std::string& filename);
 NAS2D::Xml::XmlDocument openSavegame(const std::string& filename);
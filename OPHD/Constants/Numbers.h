@@ -40,6 +40,10 @@ namespace constants
 
 	inline constexpr int DiggerTaskTime{5};
 
+	inline constexpr int RobotMaxAge{200};
+	inline constexpr int RobotAgingWarningAge{RobotMaxAge - 10};
+	inline constexpr int RobotAgingCriticalAge{RobotMaxAge - 5};
+
 	inline constexpr int CommandCenterPopulationCapacity{10};
 
 	inline constexpr int RobotCommandCapacity{10};
@@ -50,6 +54,7 @@ namespace constants
 
 	inline constexpr int RobotCommRange{15};
 	inline constexpr int LanderCommRange{5};
+	inline constexpr int CommTowerRange{10};
 
 	inline constexpr int RoadIntegrityChange{80};
 
@@ -39,6 +39,8 @@ namespace constants
 	const std::string SaveGameVersion = "0.31";
 	const std::string SaveGameRootNode = "OutpostHD_SaveGame";
 
+	const std::string TerrainCachePath = "cache/";
+
 
 	// =====================================
 	// = RESOURCES
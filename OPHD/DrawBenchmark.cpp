@@ -0,0 +1,107 @@
+#include "DrawBenchmark.h"
+
+#include "RendererRecording.h"
+
+#include "States/GameState.h"
+#include "States/MapViewState.h"
+
+#include <NAS2D/StateManager.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+
+namespace
+{
+	constexpr std::array CommandTypeNames
+	{
+		"Image",
+		"SubImage",
+		"SubImageRotated",
+		"ImageRotated",
+		"ImageStretched",
+		"ImageRepeated",
+		"SubImageRepeated",
+		"Point",
+		"Line",
+		"Box",
+		"BoxFilled",
+		"Circle",
+		"Gradient",
+		"Text",
+		"ClearScreen",
+		"ClipRect"
+	};
+
+	static_assert(CommandTypeNames.size() == static_cast<std::size_t>(RendererRecording::CommandType::Count));
+}
+
+
+/**
+ * Loads a savegame into the map view and draws it for a number of frames,
+ * then reports draw call counts and CPU time per frame to \c std::cout.
+ *
+ * \param	filename	Full path of the savegame to load.
+ * \param	frameCount	Number of frames to draw.
+ */
+void runDrawBenchmark(NAS2D::StateManager& stateManager, RendererRecording& renderer, const std::string& filename, int frameCount)
+{
+	if (frameCount <= 0)
+	{
+		throw std::runtime_error("runDrawBenchmark(): Frame count must be positive");
+	}
+
+	GameState* gameState = new GameState();
+	MapViewState* mapview = new MapViewState(gameState->getMainReportsState(), filename);
+	mapview->_initialize();
+	mapview->activate();
+
+	gameState->mapviewstate(mapview);
+	stateManager.setState(gameState);
+
+	using Clock = std::chrono::steady_clock;
+	using Microseconds = std::chrono::duration<double, std::micro>;
+
+	double totalTime = 0.0;
+	double minTime = std::numeric_limits<double>::max();
+	double maxTime = 0.0;
+	std::size_t totalDrawCalls = 0;
+	std::size_t maxDrawCalls = 0;
+	int framesDrawn = 0;
+
+	for (; framesDrawn < frameCount; ++framesDrawn)
+	{
+		renderer.clearCommands();
+
+		const auto start = Clock::now();
+		if (!stateManager.update()) { break; }
+		const auto elapsed = std::chrono::duration_cast<Microseconds>(Clock::now() - start).count();
+
+		totalTime += elapsed;
+		minTime = std::min(minTime, elapsed);
+		maxTime = std::max(maxTime, elapsed);
+		totalDrawCalls += renderer.drawCallCount();
+		maxDrawCalls = std::max(maxDrawCalls, renderer.drawCallCount());
+	}
+
+	if (framesDrawn == 0)
+	{
+		throw std::runtime_error("runDrawBenchmark(): No frames were drawn");
+	}
+
+	const auto frames = static_cast<double>(framesDrawn);
+	std::cout << "Draw benchmark: " << filename << ", " << framesDrawn << " frames" << std::endl;
+	std::cout << "\tCPU time per frame (us): mean " << totalTime / frames << ", min " << minTime << ", max " << maxTime << std::endl;
+	std::cout << "\tDraw calls per frame: mean " << static_cast<double>(totalDrawCalls) / frames << ", max " << maxDrawCalls << std::endl;
+
+	std::cout << "\tLast frame commands:" << std::endl;
+	for (std::size_t i = 0; i < CommandTypeNames.size(); ++i)
+	{
+		const auto count = renderer.count(static_cast<RendererRecording::CommandType>(i));
+		if (count > 0) { std::cout << "\t\t" << CommandTypeNames[i] << ": " << count << std::endl; }
+	}
+}
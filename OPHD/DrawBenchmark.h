@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+
+
+namespace NAS2D
+{
+	class StateManager;
+}
+
+class RendererRecording;
+
+
+void runDrawBenchmark(NAS2D::StateManager& stateManager, RendererRecording& renderer, const std::string& filename, int frameCount);
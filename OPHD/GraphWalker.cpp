@@ -71,7 +71,7 @@ static bool validConnection(Structure* src, Structure* dst, Direction direction)
 }
 
 
-void walkGraph(const std::vector<MapCoordinate>& positions, TileMap& tileMap)
+void walkGraph(const std::vector<MapCoordinate>& positions, const TileMap& tileMap)
 {
 	for (const auto& position : positions)
 	{
@@ -80,9 +80,9 @@ void walkGraph(const std::vector<MapCoordinate>& positions, TileMap& tileMap)
 }
 
 
-void walkGraph(const MapCoordinate& position, TileMap& tileMap)
+void walkGraph(const MapCoordinate& position, const TileMap& tileMap)
 {
-	Tile& thisTile = tileMap.getTile(position);
+	const Tile& thisTile = tileMap.getTile(position);
 	thisTile.structure()->connected(true);
 
 	const auto directions = std::array{
@@ -8,5 +8,5 @@ class Tile;
 class TileMap;
 
 
-void walkGraph(const std::vector<MapCoordinate>& positions, TileMap& tileMap);
-void walkGraph(const MapCoordinate& position, TileMap& tileMap);
+void walkGraph(const std::vector<MapCoordinate>& positions, const TileMap& tileMap);
+void walkGraph(const MapCoordinate& position, const TileMap& tileMap);
@@ -0,0 +1,163 @@
+#include "MaintenanceQueue.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+void MaintenanceQueue::insert(Structure& structure)
+{
+	if (mPositions.find(&structure) != mPositions.end())
+	{
+		throw std::runtime_error("MaintenanceQueue::insert(): Structure is already queued");
+	}
+
+	mHeap.push_back({makeKey(structure), &structure});
+	mPositions[&structure] = mHeap.size() - 1;
+	siftUp(mHeap.size() - 1);
+}
+
+
+void MaintenanceQueue::remove(Structure& structure)
+{
+	const auto it = mPositions.find(&structure);
+	if (it != mPositions.end())
+	{
+		removeAt(it->second);
+		return;
+	}
+
+	const auto takenIt = std::find(mTaken.begin(), mTaken.end(), &structure);
+	if (takenIt == mTaken.end())
+	{
+		throw std::runtime_error("MaintenanceQueue::remove(): Structure is not queued");
+	}
+	mTaken.erase(takenIt);
+}
+
+
+/**
+ * Reorders a structure after its integrity or state has changed.
+ *
+ * Structures currently taken for repair are left alone, they are
+ * reordered when restored.
+ */
+void MaintenanceQueue::update(Structure& structure)
+{
+	const auto it = mPositions.find(&structure);
+	if (it == mPositions.end()) { return; }
+
+	const auto index = it->second;
+	const auto key = makeKey(structure);
+	if (key == mHeap[index].key) { return; }
+
+	const auto isMoreUrgent = key < mHeap[index].key;
+	mHeap[index].key = key;
+	if (isMoreUrgent) { siftUp(index); }
+	else { siftDown(index); }
+}
+
+
+void MaintenanceQueue::clear()
+{
+	mHeap.clear();
+	mPositions.clear();
+	mTaken.clear();
+}
+
+
+/**
+ * Removes the structure most in need of repair from the queue.
+ *
+ * Taken structures are held back until restoreTaken() is called so
+ * each structure is repaired at most once in a turn.
+ *
+ * \return	The structure to repair or \c nullptr if no structure can be repaired.
+ */
+Structure* MaintenanceQueue::takeNext()
+{
+	if (mHeap.empty() || mHeap.front().key.unrepairable) { return nullptr; }
+
+	auto* structure = mHeap.front().structure;
+	removeAt(0);
+	mTaken.push_back(structure);
+	return structure;
+}
+
+
+/**
+ * Puts taken structures back into the queue ordered by their new integrity.
+ */
+void MaintenanceQueue::restoreTaken()
+{
+	auto taken = std::move(mTaken);
+	mTaken.clear();
+	for (auto* structure : taken)
+	{
+		insert(*structure);
+	}
+}
+
+
+MaintenanceQueue::Key MaintenanceQueue::makeKey(const Structure& structure)
+{
+	const bool isIntegrityDisabled = structure.disabled() && structure.disabledReason() == DisabledReason::StructuralIntegrity;
+	const bool isRepairable = !structure.destroyed() && !structure.underConstruction() &&
+		(isIntegrityDisabled || structure.operational() || structure.isIdle());
+
+	return {!isRepairable, !isIntegrityDisabled, structure.integrity()};
+}
+
+
+void MaintenanceQueue::place(std::size_t index, Entry entry)
+{
+	mPositions[entry.structure] = index;
+	mHeap[index] = entry;
+}
+
+
+void MaintenanceQueue::siftUp(std::size_t index)
+{
+	const auto entry = mHeap[index];
+	while (index > 0)
+	{
+		const auto parent = (index - 1) / 2;
+		if (!(entry.key < mHeap[parent].key)) { break; }
+
+		place(index, mHeap[parent]);
+		index = parent;
+	}
+	place(index, entry);
+}
+
+
+void MaintenanceQueue::siftDown(std::size_t index)
+{
+	const auto entry = mHeap[index];
+	const auto count = mHeap.size();
+	while (true)
+	{
+		auto child = index * 2 + 1;
+		if (child >= count) { break; }
+		if (child + 1 < count && mHeap[child + 1].key < mHeap[child].key) { ++child; }
+		if (!(mHeap[child].key < entry.key)) { break; }
+
+		place(index, mHeap[child]);
+		index = child;
+	}
+	place(index, entry);
+}
+
+
+void MaintenanceQueue::removeAt(std::size_t index)
+{
+	mPositions.erase(mHeap[index].structure);
+
+	const auto last = mHeap.back();
+	mHeap.pop_back();
+	if (index == mHeap.size()) { return; }
+
+	const auto isMoreUrgent = last.key < mHeap[index].key;
+	place(index, last);
+	if (isMoreUrgent) { siftUp(index); }
+	else { siftDown(index); }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "MapObjects/Structure.h"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+
+/**
+ * Indexed min heap of structures ordered by how urgently they need repair.
+ *
+ * Structures disabled by low structural integrity come first since they
+ * need a second repair before they work again, then the rest by lowest
+ * integrity. Structures that can't be repaired sort last. The heap
+ * position of each structure is tracked so a changed structure can be
+ * reordered in O(log n).
+ */
+class MaintenanceQueue
+{
+public:
+	void insert(Structure& structure);
+	void remove(Structure& structure);
+	void update(Structure& structure);
+	void clear();
+
+	Structure* takeNext();
+	void restoreTaken();
+
+	const StructureList& taken() const { return mTaken; }
+
+	std::size_t size() const { return mHeap.size() + mTaken.size(); }
+
+private:
+	struct Key
+	{
+		bool unrepairable;
+		bool notPriority;
+		int integrity;
+
+		auto operator<=>(const Key&) const = default;
+	};
+
+	struct Entry
+	{
+		Key key;
+		Structure* structure;
+	};
+
+	static Key makeKey(const Structure& structure);
+
+	void place(std::size_t index, Entry entry);
+	void siftUp(std::size_t index);
+	void siftDown(std::size_t index);
+	void removeAt(std::size_t index);
+
+	std::vector<Entry> mHeap;
+	std::unordered_map<const Structure*, std::size_t> mPositions;
+	StructureList mTaken;
+};
@@ -0,0 +1,96 @@
+#include "CoverageGrid.h"
+
+#include <NAS2D/Math/Rectangle.h>
+#include <NAS2D/Math/PointInRectangleRange.h>
+
+#include <algorithm>
+
+
+/**
+ * Sizes the grid to fit a map and removes all sources.
+ */
+void CoverageGrid::reset(NAS2D::Vector<int> mapSize, int depthCount)
+{
+	const auto convertedSize = mapSize.to<std::size_t>();
+	mMapSize = mapSize;
+	mCounts.assign(convertedSize.x * convertedSize.y * static_cast<std::size_t>(depthCount), 0);
+	mOverlay.reset(mapSize, depthCount);
+	mSources.clear();
+}
+
+
+/**
+ * Adds a source or updates its position and range.
+ *
+ * Coverage counts are only touched if the source is new or its
+ * position or range differs from the last update.
+ *
+ * \param	range	Coverage radius in tiles. A negative range covers
+ *					nothing, a range of 0 covers only \c position.
+ */
+void CoverageGrid::updateSource(const Structure* source, const MapCoordinate& position, int range)
+{
+	auto it = mSources.find(source);
+	if (it == mSources.end())
+	{
+		it = mSources.emplace(source, Coverage{position, -1}).first;
+	}
+
+	auto& coverage = it->second;
+	if (coverage.position.xy == position.xy && coverage.position.z == position.z && coverage.range == range)
+	{
+		return;
+	}
+
+	applyCoverage(coverage.position, coverage.range, -1);
+	applyCoverage(position, range, 1);
+	coverage.position = position;
+	coverage.range = range;
+}
+
+
+void CoverageGrid::removeSource(const Structure* source)
+{
+	const auto it = mSources.find(source);
+	if (it == mSources.end()) { return; }
+
+	applyCoverage(it->second.position, it->second.range, -1);
+	mSources.erase(it);
+}
+
+
+int CoverageGrid::coverageCount(const MapCoordinate& position) const
+{
+	return mCounts[countIndex(position)];
+}
+
+
+void CoverageGrid::applyCoverage(const MapCoordinate& position, int range, int delta)
+{
+	if (range < 0) { return; }
+
+	const auto mapArea = NAS2D::Rectangle<int>{{0, 0}, mMapSize};
+	const auto startPoint = NAS2D::Point{std::max(position.xy.x - range, 0), std::max(position.xy.y - range, 0)};
+	const auto endPoint = NAS2D::Point{std::min(position.xy.x + range + 1, mapArea.endPoint().x), std::min(position.xy.y + range + 1, mapArea.endPoint().y)};
+	if (startPoint.x >= endPoint.x || startPoint.y >= endPoint.y) { return; }
+
+	for (const auto point : NAS2D::PointInRectangleRange{NAS2D::Rectangle<int>::Create(startPoint, endPoint)})
+	{
+		if ((point - position.xy).lengthSquared() > range * range) { continue; }
+
+		const auto tilePosition = MapCoordinate{point, position.z};
+		auto& count = mCounts[countIndex(tilePosition)];
+		count = static_cast<std::uint16_t>(count + delta);
+
+		if (delta > 0 && count == 1) { mOverlay.set(tilePosition); }
+		else if (delta < 0 && count == 0) { mOverlay.unset(tilePosition); }
+	}
+}
+
+
+std::size_t CoverageGrid::countIndex(const MapCoordinate& position) const
+{
+	const auto convertedSize = mMapSize.to<std::size_t>();
+	const auto convertedPosition = position.xy.to<std::size_t>();
+	return (static_cast<std::size_t>(position.z) * convertedSize.y + convertedPosition.y) * convertedSize.x + convertedPosition.x;
+}
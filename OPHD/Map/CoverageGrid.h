@@ -0,0 +1,55 @@
+#pragma once
+
+#include "MapCoordinate.h"
+#include "OverlayLayer.h"
+
+#include <NAS2D/Math/Vector.h>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+
+class Structure;
+
+
+/**
+ * Counts how many sources cover each tile of a map.
+ *
+ * Each source covers a circle of tiles around its position. Counts are
+ * only adjusted when a source is added, moved, changes range or is
+ * removed so keeping coverage current costs nothing while the sources
+ * stay the same.
+ *
+ * An OverlayLayer with a bit set for every covered tile is kept in step
+ * with the counts for drawing and lookups.
+ */
+class CoverageGrid
+{
+public:
+	void reset(NAS2D::Vector<int> mapSize, int depthCount);
+
+	void updateSource(const Structure* source, const MapCoordinate& position, int range);
+	void removeSource(const Structure* source);
+
+	int coverageCount(const MapCoordinate& position) const;
+	bool covered(const MapCoordinate& position) const { return mOverlay.contains(position); }
+
+	const OverlayLayer& overlay() const { return mOverlay; }
+
+private:
+	struct Coverage
+	{
+		MapCoordinate position;
+		int range;
+	};
+
+	void applyCoverage(const MapCoordinate& position, int range, int delta);
+	std::size_t countIndex(const MapCoordinate& position) const;
+
+	NAS2D::Vector<int> mMapSize{0, 0};
+	std::vector<std::uint16_t> mCounts;
+	OverlayLayer mOverlay;
+
+	std::map<const Structure*, Coverage> mSources;
+};
@@ -0,0 +1,87 @@
+#include "OverlayLayer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+OverlayLayer::OverlayLayer(NAS2D::Vector<int> mapSize, int depthCount)
+{
+	reset(mapSize, depthCount);
+}
+
+
+/**
+ * Resizes the layer to fit a map and clears every bit.
+ *
+ * \note	Storage is reused when the size does not change.
+ */
+void OverlayLayer::reset(NAS2D::Vector<int> mapSize, int depthCount)
+{
+	const auto convertedSize = mapSize.to<std::size_t>();
+	mMapSize = mapSize;
+	mWordsPerDepth = (convertedSize.x * convertedSize.y + WordBits - 1) / WordBits;
+	mWords.assign(mWordsPerDepth * static_cast<std::size_t>(depthCount), 0);
+	++mRevision;
+}
+
+
+void OverlayLayer::clear()
+{
+	std::fill(mWords.begin(), mWords.end(), Word{0});
+	++mRevision;
+}
+
+
+void OverlayLayer::clear(int depth)
+{
+	const auto first = mWords.begin() + static_cast<std::ptrdiff_t>(mWordsPerDepth * static_cast<std::size_t>(depth));
+	std::fill(first, first + static_cast<std::ptrdiff_t>(mWordsPerDepth), Word{0});
+	++mRevision;
+}
+
+
+void OverlayLayer::set(const MapCoordinate& position)
+{
+	const auto index = bitIndex(position);
+	mWords[index / WordBits] |= Word{1} << (index % WordBits);
+	++mRevision;
+}
+
+
+void OverlayLayer::unset(const MapCoordinate& position)
+{
+	const auto index = bitIndex(position);
+	mWords[index / WordBits] &= ~(Word{1} << (index % WordBits));
+	++mRevision;
+}
+
+
+bool OverlayLayer::contains(const MapCoordinate& position) const
+{
+	const auto index = bitIndex(position);
+	return (mWords[index / WordBits] >> (index % WordBits)) & Word{1};
+}
+
+
+OverlayLayer& OverlayLayer::operator|=(const OverlayLayer& other)
+{
+	if (mWords.size() != other.mWords.size())
+	{
+		throw std::runtime_error("OverlayLayer::operator|=(): Layers are not the same size");
+	}
+
+	for (std::size_t i = 0; i < mWords.size(); ++i)
+	{
+		mWords[i] |= other.mWords[i];
+	}
+	++mRevision;
+	return *this;
+}
+
+
+std::size_t OverlayLayer::bitIndex(const MapCoordinate& position) const
+{
+	const auto convertedPosition = position.xy.to<std::size_t>();
+	const auto depthOffset = mWordsPerDepth * WordBits * static_cast<std::size_t>(position.z);
+	return depthOffset + convertedPosition.y * static_cast<std::size_t>(mMapSize.x) + convertedPosition.x;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "MapCoordinate.h"
+
+#include <NAS2D/Math/Vector.h>
+
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * Set of map tiles stored as one bit per tile for every depth level.
+ *
+ * Bits are laid out over linear tile indices, row by row, with each
+ * depth level padded to a whole number of words so that clearing a
+ * level or merging layers works a word at a time.
+ */
+class OverlayLayer
+{
+public:
+	OverlayLayer() = default;
+	OverlayLayer(NAS2D::Vector<int> mapSize, int depthCount);
+
+	void reset(NAS2D::Vector<int> mapSize, int depthCount);
+
+	void clear();
+	void clear(int depth);
+
+	void set(const MapCoordinate& position);
+	void unset(const MapCoordinate& position);
+	bool contains(const MapCoordinate& position) const;
+
+	OverlayLayer& operator|=(const OverlayLayer& other);
+
+	/**
+	 * Changes whenever the layer is modified.
+	 */
+	std::uint64_t revision() const { return mRevision; }
+
+private:
+	using Word = std::uint64_t;
+	static constexpr std::size_t WordBits = 64;
+
+	std::size_t bitIndex(const MapCoordinate& position) const;
+
+	NAS2D::Vector<int> mMapSize{0, 0};
+	std::size_t mWordsPerDepth{0};
+	std::vector<Word> mWords;
+	std::uint64_t mRevision{0};
+};
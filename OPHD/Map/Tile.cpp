@@ -20,8 +20,8 @@ Tile::Tile(Tile&& other) noexcept :
 	mPosition{other.mPosition},
 	mMapObject{other.mMapObject},
 	mMine{other.mMine},
-	mOverlay{other.mOverlay},
-	mExcavated{other.mExcavated}
+	mExcavated{other.mExcavated},
+	mTerrainRevision{other.mTerrainRevision}
 {
 	other.mMapObject = nullptr;
 	other.mMine = nullptr;
@@ -34,8 +34,8 @@ Tile& Tile::operator=(Tile&& other) noexcept
 	mPosition = other.mPosition;
 	mMapObject = other.mMapObject;
 	mMine = other.mMine;
-	mOverlay = other.mOverlay;
 	mExcavated = other.mExcavated;
+	mTerrainRevision = other.mTerrainRevision;
 
 	other.mMapObject = nullptr;
 	other.mMine = nullptr;
@@ -46,6 +46,7 @@ Tile& Tile::operator=(Tile&& other) noexcept
 
 Tile::~Tile()
 {
+	if (mMapObject || mMine) { ++sObjectRevision; }
 	delete mMine;
 	delete mMapObject;
 }
@@ -68,6 +69,7 @@ void Tile::pushMapObject(MapObject* mapObject)
 	}
 
 	mMapObject = mapObject;
+	++sObjectRevision;
 }
 
 
@@ -91,6 +93,7 @@ void Tile::deleteMapObject()
 void Tile::removeMapObject()
 {
 	mMapObject = nullptr;
+	++sObjectRevision;
 }
 
 
@@ -98,6 +101,7 @@ void Tile::pushMine(Mine* mine)
 {
 	delete mMine;
 	mMine = mine;
+	++sObjectRevision;
 }
 
 
@@ -7,6 +7,8 @@
 #include <NAS2D/Math/Point.h>
 #include <NAS2D/Math/Vector.h>
 
+#include <cstdint>
+
 
 class Mine;
 class MapObject;
@@ -37,7 +39,7 @@ public:
 	~Tile();
 
 	TerrainType index() const { return mIndex; }
-	void index(TerrainType index) { mIndex = index; }
+	void index(TerrainType index) { mIndex = index; terrainChanged(); }
 
 	const MapCoordinate& xyz() const { return mPosition; }
 	NAS2D::Point<int> xy() const { return mPosition.xy; }
@@ -47,7 +49,9 @@ public:
 	bool bulldozed() const { return index() == TerrainType::Dozed; }
 
 	bool excavated() const { return mExcavated; }
-	void excavated(bool value) { mExcavated = value; }
+	void excavated(bool value) { mExcavated = value; terrainChanged(); }
+
+	void terrainRevision(std::uint64_t* revision) { mTerrainRevision = revision; }
 
 	MapObject* thing() const { return mMapObject; }
 
@@ -70,12 +74,19 @@ public:
 	Mine* mine() { return mMine; }
 	void pushMine(Mine*);
 
-	void overlay(Overlay overlay) { mOverlay = overlay; }
-	Overlay overlay() const { return mOverlay; }
-
 	float movementCost() const;
 
+	/**
+	 * Changes whenever a map object or mine is added to or removed from
+	 * any tile.
+	 */
+	static std::uint64_t objectRevision() { return sObjectRevision; }
+
 private:
+	void terrainChanged() { if (mTerrainRevision) { ++*mTerrainRevision; } }
+
+	inline static std::uint64_t sObjectRevision{0};
+
 	TerrainType mIndex = TerrainType::Dozed;
 
 	MapCoordinate mPosition;
@@ -83,7 +94,7 @@ private:
 	MapObject* mMapObject = nullptr;
 	Mine* mMine = nullptr;
 
-	Overlay mOverlay{Overlay::None};
-
 	bool mExcavated = true; /**< Used when a Digger uncovers underground tiles. */
+
+	std::uint64_t* mTerrainRevision = nullptr; /**< Bumped when terrain or excavation changes, if set. */
 };
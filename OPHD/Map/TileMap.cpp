@@ -1,6 +1,7 @@
 #include "TileMap.h"
 
 #include "../Constants/Numbers.h"
+#include "../Constants/Strings.h"
 #include "../Constants/UiConstants.h"
 #include "../DirectionOffset.h"
 #include "../Mine.h"
@@ -9,6 +10,7 @@
 #include <libOPHD/RandomNumberGenerator.h>
 
 #include <NAS2D/Utility.h>
+#include <NAS2D/Filesystem.h>
 #include <NAS2D/ParserHelper.h>
 #include <NAS2D/Xml/XmlElement.h>
 #include <NAS2D/Math/PointInRectangleRange.h>
@@ -16,6 +18,10 @@
 #include <algorithm>
 #include <functional>
 #include <array>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
 
 
 using namespace NAS2D;
@@ -23,7 +29,6 @@ using namespace NAS2D;
 
 namespace {
 	const std::string MapTerrainExtension = "_a.png";
-	const auto MapSize = NAS2D::Vector{300, 150};
 
 
 	constexpr std::size_t linearSize(NAS2D::Vector<int> size)
@@ -40,6 +45,114 @@ namespace {
 	}
 
 
+	/**
+	 * Stands in for tiles in unallocated chunks when they are only read.
+	 */
+	const Tile& unallocatedTile()
+	{
+		static const Tile tile = []() {
+			Tile unexcavated;
+			unexcavated.excavated(false);
+			return unexcavated;
+		}();
+		return tile;
+	}
+
+
+	/**
+	 * Header of a terrain cache file. The header is followed by
+	 * one byte per tile holding its TerrainType, stored row by row.
+	 */
+	struct TerrainCacheHeader
+	{
+		std::array<char, 4> magic;
+		std::uint32_t version;
+		std::uint64_t imageHash;
+		std::int32_t width;
+		std::int32_t height;
+	};
+
+	const std::array<char, 4> TerrainCacheMagic{'O', 'P', 'H', 'T'};
+	const std::uint32_t TerrainCacheVersion = 1;
+
+
+	/**
+	 * 64-bit FNV-1a hash, used to key terrain caches to the
+	 * contents of their heightmap image.
+	 */
+	std::uint64_t hashData(const std::string& data)
+	{
+		std::uint64_t hash = 14695981039346656037ull;
+		for (const auto byte : data)
+		{
+			hash ^= static_cast<unsigned char>(byte);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+
+	std::string terrainCacheFilename(std::uint64_t imageHash)
+	{
+		std::ostringstream filename;
+		filename << constants::TerrainCachePath << std::hex << std::setw(16) << std::setfill('0') << imageHash << ".terrain";
+		return filename.str();
+	}
+
+
+	/**
+	 * Reads a terrain cache written by writeTerrainCache().
+	 *
+	 * \return	True if a valid cache matching \c imageHash was found.
+	 */
+	bool readTerrainCache(std::uint64_t imageHash, NAS2D::Vector<int>& size, std::vector<TerrainType>& terrainTypes)
+	{
+		const auto& filesystem = Utility<Filesystem>::get();
+		const auto filename = terrainCacheFilename(imageHash);
+		if (!filesystem.exists(filename)) { return false; }
+
+		const auto data = filesystem.readFile(filename);
+		if (data.size() < sizeof(TerrainCacheHeader)) { return false; }
+
+		TerrainCacheHeader header;
+		std::memcpy(&header, data.data(), sizeof(header));
+		if (header.magic != TerrainCacheMagic || header.version != TerrainCacheVersion || header.imageHash != imageHash) { return false; }
+
+		const auto cachedSize = NAS2D::Vector<int>{header.width, header.height};
+		if (cachedSize.x <= 0 || cachedSize.y <= 0 || data.size() != sizeof(header) + linearSize(cachedSize)) { return false; }
+
+		size = cachedSize;
+		terrainTypes.resize(linearSize(size));
+		std::transform(data.begin() + sizeof(header), data.end(), terrainTypes.begin(), [](char value) {
+			return static_cast<TerrainType>(static_cast<unsigned char>(value));
+		});
+		return true;
+	}
+
+
+	void writeTerrainCache(std::uint64_t imageHash, NAS2D::Vector<int> size, const std::vector<TerrainType>& terrainTypes)
+	{
+		const TerrainCacheHeader header{TerrainCacheMagic, TerrainCacheVersion, imageHash, size.x, size.y};
+
+		std::string data(sizeof(header), '\0');
+		std::memcpy(data.data(), &header, sizeof(header));
+		data.reserve(sizeof(header) + terrainTypes.size());
+		for (const auto terrainType : terrainTypes)
+		{
+			data.push_back(static_cast<char>(terrainType));
+		}
+
+		// The cache only saves time on later loads so failing to write it is not an error
+		try
+		{
+			Utility<Filesystem>::get().writeFile(terrainCacheFilename(imageHash), data);
+		}
+		catch (const std::runtime_error&)
+		{
+		}
+	}
+
+
 	std::vector<NAS2D::Point<int>> generateMineLocations(NAS2D::Vector<int> mapSize, std::size_t mineCount)
 	{
 		auto randPoint = [mapSize]() {
@@ -105,8 +218,8 @@ TileMap::TileMap(const std::string& mapPath, int maxDepth, std::size_t mineCount
 
 
 TileMap::TileMap(const std::string& mapPath, int maxDepth) :
-	mSizeInTiles{MapSize},
-	mMaxDepth{maxDepth}
+	mMaxDepth{maxDepth},
+	mMapPath{mapPath}
 {
 	buildTerrainMap(mapPath);
 }
@@ -131,46 +244,156 @@ bool TileMap::isValidPosition(const MapCoordinate& position) const
 }
 
 
+/**
+ * Whether the chunk containing a position has been allocated.
+ *
+ * Tiles in chunks that have not been allocated are unexcavated
+ * and empty. Reading them through a const TileMap does not
+ * allocate the chunk.
+ */
+bool TileMap::isAllocated(const MapCoordinate& position) const
+{
+	return !mTileChunks[chunkIndex(position)].empty();
+}
+
+
+/**
+ * Terrain type of a position as read from the heightmap.
+ */
+TerrainType TileMap::terrainType(NAS2D::Point<int> position) const
+{
+	return mTerrainTypes[linearIndex(position)];
+}
+
+
+/**
+ * Changes whenever the terrain or excavation of a tile on a depth level
+ * changes, used to tell when cached terrain drawing must be rebuilt.
+ *
+ * Allocating a chunk does not change the revision.
+ */
+std::uint64_t TileMap::terrainRevision(int depth) const
+{
+	return mTerrainRevisions[static_cast<std::size_t>(depth)];
+}
+
+
 const Tile& TileMap::getTile(const MapCoordinate& position) const
 {
 	if (!isValidPosition(position))
 	{
 		throw std::runtime_error("Tile coordinates out of bounds: {" + std::to_string(position.xy.x) + ", " + std::to_string(position.xy.y) + ", " + std::to_string(position.z) + "}");
 	}
-	return mTileMap[linearIndex(position)];
+	return tileAt(position);
 }
 
 
 Tile& TileMap::getTile(const MapCoordinate& position)
 {
-	const auto& constThis = *this;
-	return const_cast<Tile&>(constThis.getTile(position));
+	if (!isValidPosition(position))
+	{
+		throw std::runtime_error("Tile coordinates out of bounds: {" + std::to_string(position.xy.x) + ", " + std::to_string(position.xy.y) + ", " + std::to_string(position.z) + "}");
+	}
+	return tileAt(position);
+}
+
+
+/**
+ * Number of tiles in a single depth level.
+ */
+std::size_t TileMap::linearSize() const
+{
+	return ::linearSize(mSizeInTiles);
+}
+
+
+/**
+ * Index of a position within a single depth level, stored row by row.
+ *
+ * Suitable for indexing per depth data kept alongside the map.
+ */
+std::size_t TileMap::linearIndex(NAS2D::Point<int> position) const
+{
+	return ::linearIndex(position, mSizeInTiles.x);
+}
+
+
+/**
+ * Throws if any part of an area lies outside of the map.
+ */
+void TileMap::validateArea(const NAS2D::Rectangle<int>& area, int depth) const
+{
+	const auto mapArea = NAS2D::Rectangle{{0, 0}, mSizeInTiles};
+	if (
+		!mapArea.contains(area.position) ||
+		area.endPoint().x > mSizeInTiles.x || area.endPoint().y > mSizeInTiles.y ||
+		depth < 0 || depth > mMaxDepth
+	)
+	{
+		throw std::runtime_error("Tile area out of bounds: {" + std::to_string(area.position.x) + ", " + std::to_string(area.position.y) + ", " + std::to_string(area.size.x) + ", " + std::to_string(area.size.y) + ", " + std::to_string(depth) + "}");
+	}
+}
+
+
+/**
+ * Area of the map covered by a chunk, clipped to the map bounds.
+ *
+ * \param	chunkPosition	Position of the chunk in chunk coordinates.
+ */
+NAS2D::Rectangle<int> TileMap::chunkArea(NAS2D::Point<int> chunkPosition) const
+{
+	const auto startPoint = NAS2D::Point{chunkPosition.x * ChunkSize.x, chunkPosition.y * ChunkSize.y};
+	const auto endPoint = NAS2D::Point{
+		std::min(startPoint.x + ChunkSize.x, mSizeInTiles.x),
+		std::min(startPoint.y + ChunkSize.y, mSizeInTiles.y)
+	};
+	return NAS2D::Rectangle<int>::Create(startPoint, endPoint);
 }
 
 
 void TileMap::buildTerrainMap(const std::string& path)
 {
-	const Image heightmap(path + MapTerrainExtension);
+	const auto heightmapPath = path + MapTerrainExtension;
+	const auto imageHash = hashData(Utility<Filesystem>::get().readFile(heightmapPath));
 
-	mTileMap.resize(linearSize());
+	if (!readTerrainCache(imageHash, mSizeInTiles, mTerrainTypes))
+	{
+		buildTerrainTypes(heightmapPath);
+		writeTerrainCache(imageHash, mSizeInTiles, mTerrainTypes);
+	}
 
-	/**
-	 * Builds a terrain map based on the pixel color values in
-	 * a maps height map.
-	 * 
-	 * Height maps by default are in grey-scale. This method assumes
-	 * that all channels are the same value so it only looks at the red.
-	 * Color values are divided by 50 to get a height value from 1 - 4.
-	 */
-	for (int depth = 0; depth <= mMaxDepth; depth++)
+	mSizeInChunks = (mSizeInTiles + ChunkSize - NAS2D::Vector{1, 1}).skewInverseBy(ChunkSize);
+
+	const auto chunkCount = ::linearSize(mSizeInChunks) * static_cast<std::size_t>(mMaxDepth + 1);
+	mTileChunks.resize(chunkCount);
+	mTerrainRevisions.resize(static_cast<std::size_t>(mMaxDepth + 1));
+
+	// The surface is always in use, underground chunks are allocated on first access
+	for (const auto chunkPosition : PointInRectangleRange{Rectangle{{0, 0}, mSizeInChunks}})
 	{
-		for (const auto point : PointInRectangleRange{Rectangle{{0, 0}, mSizeInTiles}})
-		{
-			auto color = heightmap.pixelColor(point);
-			auto& tile = getTile({point, depth});
-			tile = {{point, depth}, static_cast<TerrainType>(color.red / 50)};
-			if (depth > 0) { tile.excavated(false); }
-		}
+		allocateChunk({chunkArea(chunkPosition).position, 0});
+	}
+}
+
+
+/**
+ * Builds a terrain map based on the pixel color values in
+ * a maps height map.
+ *
+ * Height maps by default are in grey-scale. This method assumes
+ * that all channels are the same value so it only looks at the red.
+ * Color values are divided by 50 to get a height value from 1 - 4.
+ */
+void TileMap::buildTerrainTypes(const std::string& heightmapPath)
+{
+	const Image heightmap(heightmapPath);
+
+	mSizeInTiles = heightmap.size();
+	mTerrainTypes.resize(linearSize());
+	for (const auto point : PointInRectangleRange{Rectangle{{0, 0}, mSizeInTiles}})
+	{
+		auto color = heightmap.pixelColor(point);
+		mTerrainTypes[linearIndex(point)] = static_cast<TerrainType>(color.red / 50);
 	}
 }
 
@@ -200,26 +423,27 @@ void TileMap::serialize(NAS2D::Xml::XmlElement* element)
 	// underground and excavated or surface and bulldozed.
 	for (int depth = 0; depth <= maxDepth(); ++depth)
 	{
-		for (const auto point : PointInRectangleRange{Rectangle{{0, 0}, mSizeInTiles}})
+		for (const auto chunkPosition : PointInRectangleRange{Rectangle{{0, 0}, mSizeInChunks}})
 		{
-			auto& tile = getTile({point, depth});
-			if (
-				((depth > 0 && tile.excavated()) || (tile.index() == TerrainType::Dozed)) &&
-				(tile.empty() && tile.mine() == nullptr)
-			)
-			{
-				tiles->linkEndChild(
-					NAS2D::dictionaryToAttributes(
-						"tile",
-						{{
-							{"x", point.x},
-							{"y", point.y},
-							{"depth", depth},
-							{"index", static_cast<int>(tile.index())},
-						}}
-					)
-				);
-			}
+			forEachAllocatedTile(chunkArea(chunkPosition), depth, [tiles, depth](const Tile& tile) {
+				if (
+					((depth > 0 && tile.excavated()) || (tile.index() == TerrainType::Dozed)) &&
+					(tile.empty() && tile.mine() == nullptr)
+				)
+				{
+					tiles->linkEndChild(
+						NAS2D::dictionaryToAttributes(
+							"tile",
+							{{
+								{"x", tile.xy().x},
+								{"y", tile.xy().y},
+								{"depth", depth},
+								{"index", static_cast<int>(tile.index())},
+							}}
+						)
+					);
+				}
+			});
 		}
 	}
 }
@@ -286,7 +510,7 @@ void TileMap::AdjacentCost(void* state, std::vector<micropather::StateCost>* adj
 			continue;
 		}
 
-		auto& adjacentTile = getTile({position, 0});
+		auto& adjacentTile = getTileUnchecked({position, 0});
 		float cost = adjacentTile.movementCost();
 
 		micropather::StateCost nodeCost = {&adjacentTile, cost};
@@ -295,19 +519,108 @@ void TileMap::AdjacentCost(void* state, std::vector<micropather::StateCost>* adj
 }
 
 
-std::size_t TileMap::linearSize() const
+/**
+ * Index of the chunk containing a position.
+ *
+ * Chunks are laid out row by row, with each depth level following the previous one.
+ */
+std::size_t TileMap::chunkIndex(const MapCoordinate& position) const
+{
+	const auto convertedSize = mSizeInChunks.to<std::size_t>();
+	const auto chunkPosition = NAS2D::Point{position.xy.x / ChunkSize.x, position.xy.y / ChunkSize.y}.to<std::size_t>();
+	const auto convertedZ = static_cast<std::size_t>(position.z);
+	return ((convertedZ * convertedSize.y) + chunkPosition.y) * convertedSize.x + chunkPosition.x;
+}
+
+
+/**
+ * Index of a position within its containing chunk.
+ */
+std::size_t TileMap::chunkTileIndex(NAS2D::Point<int> position) const
 {
-	const auto convertedSize = mSizeInTiles.to<std::size_t>();
-	const auto adjustedZ = mMaxDepth + 1;
-	return convertedSize.x * convertedSize.y * static_cast<std::size_t>(adjustedZ);
+	return ::linearIndex({position.x % ChunkSize.x, position.y % ChunkSize.y}, ChunkSize.x);
 }
 
 
+/**
+ * Allocates the chunk containing a position and fills it with
+ * tiles built from the terrain map.
+ *
+ * \note	Allocating a chunk does not move the tiles of other
+ *			chunks so references to existing tiles remain valid.
+ */
+void TileMap::allocateChunk(const MapCoordinate& position)
+{
+	auto& chunk = mTileChunks[chunkIndex(position)];
+	chunk.resize(::linearSize(ChunkSize));
+
+	const auto chunkPosition = NAS2D::Point{position.xy.x / ChunkSize.x, position.xy.y / ChunkSize.y};
+	for (const auto point : PointInRectangleRange{chunkArea(chunkPosition)})
+	{
+		auto& tile = chunk[chunkTileIndex(point)];
+		tile = {{point, position.z}, terrainType(point)};
+		if (position.z > 0) { tile.excavated(false); }
+		tile.terrainRevision(&mTerrainRevisions[static_cast<std::size_t>(position.z)]);
+	}
+}
+
 
-std::size_t TileMap::linearIndex(const MapCoordinate& position) const
+/**
+ * Tile at a position, without allocating its chunk.
+ *
+ * Positions in unallocated chunks get a shared unexcavated and empty
+ * tile. Its position is not that of the requested tile.
+ *
+ * \warning	Does not validate \c position.
+ */
+const Tile& TileMap::tileAt(const MapCoordinate& position) const
 {
-	const auto convertedSize = mSizeInTiles.to<std::size_t>();
-	const auto convertedPosition = position.xy.to<std::size_t>();
-	const auto convertedZ = static_cast<std::size_t>(position.z);
-	return ((convertedZ * convertedSize.y) + convertedPosition.y) * convertedSize.x + convertedPosition.x;
+	const auto& chunk = mTileChunks[chunkIndex(position)];
+	return chunk.empty() ? unallocatedTile() : chunk[chunkTileIndex(position.xy)];
+}
+
+
+/**
+ * Tile at a position, allocating its chunk if needed.
+ *
+ * \warning	Does not validate \c position.
+ */
+Tile& TileMap::tileAt(const MapCoordinate& position)
+{
+	auto& chunk = mTileChunks[chunkIndex(position)];
+	if (chunk.empty())
+	{
+		allocateChunk(position);
+	}
+	return chunk[chunkTileIndex(position.xy)];
+}
+
+
+/**
+ * Pointer to a tile within its chunk, allocating the chunk if needed.
+ * Tiles to the right of it up to the chunk boundary follow it contiguously.
+ */
+Tile* TileMap::rowSegment(const MapCoordinate& position)
+{
+	return &tileAt(position);
+}
+
+
+/**
+ * Pointer to a tile within its chunk. Tiles to the right of it up to
+ * the chunk boundary follow it contiguously.
+ *
+ * \return	nullptr if the chunk is unallocated.
+ */
+const Tile* TileMap::allocatedRowSegment(const MapCoordinate& position) const
+{
+	const auto& chunk = mTileChunks[chunkIndex(position)];
+	return chunk.empty() ? nullptr : &chunk[chunkTileIndex(position.xy)];
+}
+
+
+Tile* TileMap::allocatedRowSegment(const MapCoordinate& position)
+{
+	auto& chunk = mTileChunks[chunkIndex(position)];
+	return chunk.empty() ? nullptr : &chunk[chunkTileIndex(position.xy)];
 }
@@ -12,7 +12,9 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <cstdint>
 #include <utility>
+#include <algorithm>
 
 
 namespace NAS2D
@@ -31,19 +33,75 @@ class TileMap : public micropather::Graph
 public:
 	using MineYields = std::array<int, 3>; // {low, med, high}
 
+	static constexpr auto ChunkSize = NAS2D::Vector{32, 32};
+
 	TileMap(const std::string& mapPath, int maxDepth, std::size_t mineCount, const MineYields& mineYields);
 	TileMap(const std::string& mapPath, int maxDepth);
 	TileMap(const TileMap&) = delete;
 	TileMap& operator=(const TileMap&) = delete;
 
 	NAS2D::Vector<int> size() const { return mSizeInTiles; }
+	NAS2D::Vector<int> sizeInChunks() const { return mSizeInChunks; }
 	int maxDepth() const { return mMaxDepth; }
 
+	NAS2D::Rectangle<int> chunkArea(NAS2D::Point<int> chunkPosition) const;
+
 	bool isValidPosition(const MapCoordinate& position) const;
+	bool isAllocated(const MapCoordinate& position) const;
+
+	TerrainType terrainType(NAS2D::Point<int> position) const;
+	std::uint64_t terrainRevision(int depth) const;
 
 	const Tile& getTile(const MapCoordinate& position) const;
 	Tile& getTile(const MapCoordinate& position);
 
+	/**
+	 * Gets a tile without validating its position.
+	 *
+	 * \warning	\c position must be a valid position. Use getTile()
+	 *			for positions that come from untrusted input.
+	 */
+	const Tile& getTileUnchecked(const MapCoordinate& position) const { return tileAt(position); }
+	Tile& getTileUnchecked(const MapCoordinate& position) { return tileAt(position); }
+
+	std::size_t linearSize() const;
+	std::size_t linearIndex(NAS2D::Point<int> position) const;
+
+	void validateArea(const NAS2D::Rectangle<int>& area, int depth) const;
+
+	/**
+	 * Calls a function for every tile in an area, row by row.
+	 *
+	 * The area is validated once. Tiles are then visited one chunk
+	 * row at a time without per tile bounds checks.
+	 */
+	template <typename Function>
+	void forEachTile(const NAS2D::Rectangle<int>& area, int depth, Function function)
+	{
+		validateArea(area, depth);
+		visitArea(area, depth, [this](const MapCoordinate& position) { return rowSegment(position); }, function);
+	}
+
+	/**
+	 * Calls a function for every allocated tile in an area, row by row.
+	 *
+	 * Tiles in unallocated chunks are unexcavated and empty and are
+	 * skipped without allocating them.
+	 */
+	template <typename Function>
+	void forEachAllocatedTile(const NAS2D::Rectangle<int>& area, int depth, Function function) const
+	{
+		validateArea(area, depth);
+		visitArea(area, depth, [this](const MapCoordinate& position) { return allocatedRowSegment(position); }, function);
+	}
+
+	template <typename Function>
+	void forEachAllocatedTile(const NAS2D::Rectangle<int>& area, int depth, Function function)
+	{
+		validateArea(area, depth);
+		visitArea(area, depth, [this](const MapCoordinate& position) { return allocatedRowSegment(position); }, function);
+	}
+
 	const std::vector<NAS2D::Point<int>>& mineLocations() const { return mMineLocations; }
 	void removeMineLocation(const NAS2D::Point<int>& pt);
 
@@ -57,15 +115,57 @@ public:
 	void PrintStateInfo(void* /*state*/) override {}
 
 private:
-	std::size_t linearSize() const;
-	std::size_t linearIndex(const MapCoordinate& position) const;
+	using TileChunk = std::vector<Tile>; /**< Fixed size block of tiles, stored row by row. */
+
+	std::size_t chunkIndex(const MapCoordinate& position) const;
+	std::size_t chunkTileIndex(NAS2D::Point<int> position) const;
+
+	const Tile& tileAt(const MapCoordinate& position) const;
+	Tile& tileAt(const MapCoordinate& position);
+	Tile* rowSegment(const MapCoordinate& position);
+	const Tile* allocatedRowSegment(const MapCoordinate& position) const;
+	Tile* allocatedRowSegment(const MapCoordinate& position);
+
+	/**
+	 * Visits an area one chunk row segment at a time. \c segmentAt gets
+	 * the first tile of a segment, or \c nullptr to skip the segment.
+	 */
+	template <typename SegmentFunction, typename Function>
+	static void visitArea(const NAS2D::Rectangle<int>& area, int depth, SegmentFunction segmentAt, Function& function)
+	{
+		const auto endPoint = area.endPoint();
+		for (int y = area.position.y; y < endPoint.y; ++y)
+		{
+			for (int x = area.position.x; x < endPoint.x;)
+			{
+				const auto segmentEnd = std::min(endPoint.x, (x / ChunkSize.x + 1) * ChunkSize.x);
+				auto* tile = segmentAt({{x, y}, depth});
+				if (tile == nullptr)
+				{
+					x = segmentEnd;
+					continue;
+				}
+
+				for (; x < segmentEnd; ++x, ++tile)
+				{
+					function(*tile);
+				}
+			}
+		}
+	}
+
+	void allocateChunk(const MapCoordinate& position);
 
 	void buildTerrainMap(const std::string& path);
+	void buildTerrainTypes(const std::string& heightmapPath);
 
 
-	const NAS2D::Vector<int> mSizeInTiles;
+	NAS2D::Vector<int> mSizeInTiles;
+	NAS2D::Vector<int> mSizeInChunks;
 	const int mMaxDepth = 0;
-	std::vector<Tile> mTileMap;
+	std::vector<TerrainType> mTerrainTypes;
+	std::vector<TileChunk> mTileChunks; /**< Underground chunks stay empty until first modified. */
+	std::vector<std::uint64_t> mTerrainRevisions; /**< One per depth level. */
 	std::vector<NAS2D::Point<int>> mMineLocations;
 
 	std::string mMapPath;
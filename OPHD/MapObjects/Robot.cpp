@@ -77,7 +77,7 @@ void Robot::update()
 
 	mFuelCellAge++;
 
-	if (mFuelCellAge == 200)
+	if (mFuelCellAge == constants::RobotMaxAge)
 	{
 		die();
 	}
@@ -208,6 +208,7 @@ void Structure::forceIdle(bool force)
 		mForcedIdle = false;
 		enable();
 	}
+	++mStateRevision;
 }
 
 const StorableResources& Structure::resourcesIn() const
@@ -324,6 +325,7 @@ void Structure::update()
 void Structure::incrementAge()
 {
 	mAge++;
+	++mStateRevision;
 
 	if (age() == turnsToBuild())
 	{
@@ -350,6 +352,7 @@ void Structure::updateIntegrityDecay()
 	if (state() == StructureState::UnderConstruction) { return; }
 
 	mIntegrity = std::clamp(mIntegrity - integrityDecayRate(), 0, mIntegrity);
+	++mStateRevision;
 
 	if (mIntegrity <= 35 && !disabled())
 	{
@@ -371,6 +374,15 @@ void Structure::updateIntegrityDecay()
 }
 
 
+void Structure::state(StructureState newState)
+{
+	const auto changed = newState != mStructureState;
+	mStructureState = newState;
+	++mStateRevision;
+	if (changed) { mStateChanged(*this); }
+}
+
+
 /**
 * Sets a destroyed state.
 *
@@ -398,7 +410,7 @@ void Structure::forced_state_change(StructureState structureState, DisabledReaso
 	else if (structureState == StructureState::Idle) { idle(idleReason); }
 	else if (structureState == StructureState::Disabled) { disable(disabledReason); }
 	else if (structureState == StructureState::Destroyed) { destroy(); }
-	else if (structureState == StructureState::UnderConstruction) { mStructureState = StructureState::UnderConstruction; } // Kludge
+	else if (structureState == StructureState::UnderConstruction) { state(StructureState::UnderConstruction); } // Kludge
 }
 
 
@@ -428,18 +440,21 @@ void Structure::die()
 void Structure::crimeRate(int crimeRate)
 {
 	mCrimeRate = std::clamp(crimeRate, 0, 100);
+	++mStateRevision;
 }
 
 
 void Structure::increaseCrimeRate(int deltaCrimeRate)
 {
 	mCrimeRate = std::clamp(mCrimeRate + deltaCrimeRate, 0, 100);
+	++mStateRevision;
 }
 
 
 void Structure::integrity(int integrity)
 {
 	mIntegrity = integrity;
+	++mStateRevision;
 }
 
 
@@ -9,6 +9,8 @@
 
 #include <NAS2D/Dictionary.h>
 
+#include <cstdint>
+
 
 struct StructureType;
 
@@ -102,6 +104,18 @@ public:
 	void forceIdle(bool force);
 	bool forceIdle() const { return mForcedIdle; }
 
+	/**
+	 * Incremented whenever the state, age, integrity or crime rate
+	 * of the Structure changes.
+	 *
+	 * \note	Changes made through storage(), production() or
+	 *			populationAvailable() are not tracked.
+	 */
+	std::uint64_t stateRevision() const { return mStateRevision; }
+
+	using StateChangedSignal = NAS2D::Signal<Structure&>;
+	StateChangedSignal::Source& stateChanged() { return mStateChanged; }
+
 	// RESOURCES AND RESOURCE MANAGEMENT
 	const StorableResources& resourcesIn() const;
 
@@ -155,7 +169,7 @@ public:
 	bool isConnector() const { return mStructureClass == StructureClass::Tube; }
 	bool isRoad() const { return mStructureClass == StructureClass::Road; }
 
-	void age(int newAge) { mAge = newAge; }
+	void age(int newAge) { mAge = newAge; ++mStateRevision; }
 	void connectorDirection(ConnectorDir dir) { mConnectorDirection = dir; }
 
 	virtual void forced_state_change(StructureState, DisabledReason, IdleReason);
@@ -179,7 +193,7 @@ protected:
 
 	virtual void disabledStateSet() {}
 
-	void state(StructureState newState) { mStructureState = newState; }
+	void state(StructureState newState);
 
 private:
 	Structure() = delete;
@@ -215,6 +229,9 @@ private:
 	DisabledReason mDisabledReason{DisabledReason::None};
 	IdleReason mIdleReason{IdleReason::None};
 
+	std::uint64_t mStateRevision{0};
+	StateChangedSignal mStateChanged; /**< Signal used when the structure state changes. */
+
 	bool mConnected{false};
 	bool mForcedIdle{false}; /**< Indicates that the Structure was manually set to Idle by the user and should remain that way until the user says otherwise. */
 };
@@ -8,9 +8,6 @@
 
 class CommTower : public Structure
 {
-private:
-	const int BaseRange = 10;
-
 public:
 	CommTower() : Structure(
 		StructureClass::Communication,
@@ -21,7 +18,7 @@ public:
 
 	int getRange() const
 	{
-		return operational() ? BaseRange : 0;
+		return operational() ? constants::CommTowerRange : 0;
 	}
 
 
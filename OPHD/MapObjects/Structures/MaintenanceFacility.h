@@ -2,6 +2,8 @@
 
 #include "../Structure.h"
 
+#include "../../MaintenanceQueue.h"
+
 #include <algorithm>
 
 #include "../../Constants/Strings.h"
@@ -73,41 +75,20 @@ public:
 	}
 
 
-	void addPriorityStructure(Structure* structure)
-	{
-		mPriorityList.push_back(structure);
-	}
-
-
-	void removePriorityStructure(Structure* structure)
-	{
-		auto it = std::find(mPriorityList.begin(), mPriorityList.end(), structure);
-		if (it != mPriorityList.end())
-		{
-			mPriorityList.erase(it);
-		}
-	}
-
-
-	bool hasPriorityStructures() const
-	{
-		return !mPriorityList.empty();
-	}
-
-
-	void repairStructures(StructureList& structures)
+	/**
+	 * Repairs the structures most in need of repair until personnel or
+	 * supplies run out.
+	 */
+	void repairStructures(MaintenanceQueue& queue)
 	{
 		if (!operational()) { return; }
 
-		if (hasPriorityStructures())
+		while (canMakeRepairs())
 		{
-			repairPriorityStructures(structures);
-		}
+			auto* structure = queue.takeNext();
+			if (!structure) { return; }
 
-		for (auto structure : structures)
-		{
 			repairStructure(structure);
-			std::rotate(structures.begin(), structures.begin() + 1, structures.end());
 		}
 	}
 
@@ -119,35 +100,6 @@ protected:
 	}
 
 
-	void moveStructureToBack(StructureList& structures, Structure* structure)
-	{
-		auto it = std::find(structures.begin(), structures.end(), structure);
-		if (it != structures.end())
-		{
-			structures.erase(it);
-			structures.push_back(structure);
-		}
-	}
-
-
-	void repairPriorityStructures(StructureList& structures)
-	{
-		for (auto structure : mPriorityList)
-		{
-			if (!canMakeRepairs()) { return; }
-
-			repairStructure(structure);
-
-			moveStructureToBack(structures, structure);
-
-			if (structure->operational())
-			{
-				removePriorityStructure(structure);
-			}
-		}
-	}
-
-
 	void repairStructure(Structure* structure)
 	{
 		if (structure->destroyed() || structure->underConstruction()) { return; }
@@ -166,7 +118,6 @@ protected:
 			else
 			{
 				structure->integrity(50);
-				addPriorityStructure(structure);
 			}
 		}
 		else if (structure->operational() || structure->isIdle())
@@ -206,7 +157,5 @@ private:
 	int mMaintenancePersonnel{MinimumPersonnel};
 	int mAssignedPersonnel{0};
 
-	StructureList mPriorityList;
-
 	const StorableResources* mResources{nullptr};
 };
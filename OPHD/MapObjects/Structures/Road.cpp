@@ -0,0 +1,74 @@
+#include "Road.h"
+
+#include "../../Common.h"
+#include "../../Constants/Numbers.h"
+
+#include <array>
+#include <string>
+
+
+namespace
+{
+	enum RoadCondition
+	{
+		Intact,
+		Decayed,
+		RoadConditionCount
+	};
+
+
+	/**
+	 * Animation names for every neighbour mask and road condition, indexed
+	 * by \c mask * \c RoadConditionCount + \c condition.
+	 */
+	const std::string& roadAnimation(std::size_t index)
+	{
+		static const auto table = []() {
+			std::array<std::string, IntersectionPatternTable.size() * RoadConditionCount> names;
+			for (std::size_t mask = 0; mask < IntersectionPatternTable.size(); ++mask)
+			{
+				names[mask * RoadConditionCount + Intact] = IntersectionPatternTable[mask];
+				names[mask * RoadConditionCount + Decayed] = IntersectionPatternTable[mask] + "-decayed";
+			}
+			return names;
+		}();
+
+		return table[index];
+	}
+}
+
+
+/**
+ * Sets the mask of neighbouring roads.
+ *
+ * \param	mask	Bit \c i is set when there is a road in direction
+ *					\c DirectionClockwise4[i].
+ */
+void Road::neighbourMask(std::size_t mask)
+{
+	mNeighbourMask = mask;
+	updateAnimation();
+}
+
+
+/**
+ * Plays the intersection animation matching the road's neighbours and
+ * integrity if it isn't already playing.
+ *
+ * \note	Roads that aren't operational keep their current animation.
+ */
+void Road::updateAnimation()
+{
+	if (!operational())
+	{
+		mAnimation = NoAnimation;
+		return;
+	}
+
+	const std::size_t condition = (integrity() < constants::RoadIntegrityChange) ? Decayed : Intact;
+	const auto animation = mNeighbourMask * RoadConditionCount + condition;
+	if (animation == mAnimation) { return; }
+
+	mAnimation = animation;
+	sprite().play(roadAnimation(animation));
+}
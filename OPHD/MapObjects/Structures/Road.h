@@ -4,7 +4,16 @@
 
 #include "../../Constants/Strings.h"
 
+#include <cstddef>
+#include <limits>
 
+
+/**
+ * Implements the Road.
+ *
+ * The intersection animation is picked from a mask of the neighbouring
+ * roads and is only replayed when the mask or the road's condition changes.
+ */
 class Road : public Structure
 {
 public:
@@ -13,4 +22,25 @@ public:
 		StructureID::SID_ROAD)
 	{
 	}
+
+	void neighbourMask(std::size_t mask);
+	std::size_t neighbourMask() const { return mNeighbourMask; }
+
+	void updateAnimation();
+
+protected:
+	void think() override { updateAnimation(); }
+
+	void activated() override
+	{
+		// activate() replaces the intersection animation
+		mAnimation = NoAnimation;
+		updateAnimation();
+	}
+
+private:
+	static constexpr auto NoAnimation{std::numeric_limits<std::size_t>::max()};
+
+	std::size_t mNeighbourMask{0};
+	std::size_t mAnimation{NoAnimation};
 };
@@ -1,5 +1,6 @@
 #include "PopulationPool.h"
-#include "Population/Population.h"
+
+#include <libOPHD/Population/Population.h>
 
 #include <algorithm>
 #include <string>
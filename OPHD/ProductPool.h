@@ -34,6 +34,7 @@ public:
 	void store(ProductType type, int count);
 	int pull(ProductType type, int count);
 	int count(ProductType type);
+	const ProductTypeCount& counts() const { return mProducts; }
 
 	int availableStorage() const;
 	int availableStoragePercent() const;
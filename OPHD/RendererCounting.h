@@ -0,0 +1,147 @@
+#pragma once
+
+#include <NAS2D/Renderer/Renderer.h>
+#include <NAS2D/Resource/Image.h>
+
+#include <cstddef>
+
+
+/**
+ * Draw call and texture change counts of a renderer.
+ */
+class DrawCallCounter
+{
+public:
+	virtual ~DrawCallCounter() = default;
+
+	std::size_t drawCalls() const { return mDrawCalls; }
+
+	/**
+	 * Estimated texture binds: image draws whose texture differs from the
+	 * previous image draw.
+	 */
+	std::size_t textureBinds() const { return mTextureBinds; }
+
+	void resetCounts()
+	{
+		mDrawCalls = 0;
+		mTextureBinds = 0;
+		mLastTexture = NoTexture;
+	}
+
+protected:
+	void countDraw() { ++mDrawCalls; }
+
+	void countImageDraw(const NAS2D::Image& image)
+	{
+		++mDrawCalls;
+		const auto texture = image.textureId();
+		if (texture != mLastTexture)
+		{
+			++mTextureBinds;
+			mLastTexture = texture;
+		}
+	}
+
+private:
+	static constexpr unsigned int NoTexture{0};
+
+	std::size_t mDrawCalls{0};
+	std::size_t mTextureBinds{0};
+	unsigned int mLastTexture{NoTexture};
+};
+
+
+/**
+ * Counts the draw calls made through a renderer before passing them on.
+ */
+template <typename BaseRenderer>
+class RendererCounting : public BaseRenderer, public DrawCallCounter
+{
+public:
+	using BaseRenderer::BaseRenderer;
+
+	void drawImage(const NAS2D::Image& image, NAS2D::Point<float> position, float scale = 1.0, NAS2D::Color color = NAS2D::Color::Normal) override
+	{
+		countImageDraw(image);
+		BaseRenderer::drawImage(image, position, scale, color);
+	}
+
+	void drawSubImage(const NAS2D::Image& image, NAS2D::Point<float> raster, const NAS2D::Rectangle<float>& subImageRect, NAS2D::Color color = NAS2D::Color::Normal) override
+	{
+		countImageDraw(image);
+		BaseRenderer::drawSubImage(image, raster, subImageRect, color);
+	}
+
+	void drawSubImageRotated(const NAS2D::Image& image, NAS2D::Point<float> raster, const NAS2D::Rectangle<float>& subImageRect, NAS2D::Angle degrees, NAS2D::Color color = NAS2D::Color::Normal) override
+	{
+		countImageDraw(image);
+		BaseRenderer::drawSubImageRotated(image, raster, subImageRect, degrees, color);
+	}
+
+	void drawImageRotated(const NAS2D::Image& image, NAS2D::Point<float> position, NAS2D::Angle degrees, NAS2D::Color color = NAS2D::Color::Normal, float scale = 1.0f) override
+	{
+		countImageDraw(image);
+		BaseRenderer::drawImageRotated(image, position, degrees, color, scale);
+	}
+
+	void drawImageStretched(const NAS2D::Image& image, const NAS2D::Rectangle<float>& rect, NAS2D::Color color = NAS2D::Color::Normal) override
+	{
+		countImageDraw(image);
+		BaseRenderer::drawImageStretched(image, rect, color);
+	}
+
+	void drawImageRepeated(const NAS2D::Image& image, const NAS2D::Rectangle<float>& rect) override
+	{
+		countImageDraw(image);
+		BaseRenderer::drawImageRepeated(image, rect);
+	}
+
+	void drawSubImageRepeated(const NAS2D::Image& image, const NAS2D::Rectangle<float>& destination, const NAS2D::Rectangle<int>& source) override
+	{
+		countImageDraw(image);
+		BaseRenderer::drawSubImageRepeated(image, destination, source);
+	}
+
+	void drawPoint(NAS2D::Point<float> position, NAS2D::Color color = NAS2D::Color::White) override
+	{
+		countDraw();
+		BaseRenderer::drawPoint(position, color);
+	}
+
+	void drawLine(NAS2D::Point<float> startPosition, NAS2D::Point<float> endPosition, NAS2D::Color color = NAS2D::Color::White, int lineWidth = 1) override
+	{
+		countDraw();
+		BaseRenderer::drawLine(startPosition, endPosition, color, lineWidth);
+	}
+
+	void drawBox(const NAS2D::Rectangle<float>& rect, NAS2D::Color color = NAS2D::Color::White) override
+	{
+		countDraw();
+		BaseRenderer::drawBox(rect, color);
+	}
+
+	void drawBoxFilled(const NAS2D::Rectangle<float>& rect, NAS2D::Color color = NAS2D::Color::White) override
+	{
+		countDraw();
+		BaseRenderer::drawBoxFilled(rect, color);
+	}
+
+	void drawCircle(NAS2D::Point<float> position, float radius, NAS2D::Color color, int numSegments = 10, NAS2D::Vector<float> scale = NAS2D::Vector<float>{1.0f, 1.0f}) override
+	{
+		countDraw();
+		BaseRenderer::drawCircle(position, radius, color, numSegments, scale);
+	}
+
+	void drawGradient(const NAS2D::Rectangle<float>& rect, NAS2D::Color c1, NAS2D::Color c2, NAS2D::Color c3, NAS2D::Color c4) override
+	{
+		countDraw();
+		BaseRenderer::drawGradient(rect, c1, c2, c3, c4);
+	}
+
+	void drawText(const NAS2D::Font& font, std::string_view text, NAS2D::Point<float> position, NAS2D::Color color = NAS2D::Color::White) override
+	{
+		countDraw();
+		BaseRenderer::drawText(font, text, position, color);
+	}
+};
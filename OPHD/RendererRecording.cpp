@@ -0,0 +1,130 @@
+#include "RendererRecording.h"
+
+#include <NAS2D/Resource/Image.h>
+#include <NAS2D/Resource/Font.h>
+
+
+using namespace NAS2D;
+
+
+/**
+ * Number of commands recorded that put something on screen.
+ */
+std::size_t RendererRecording::drawCallCount() const
+{
+	return mCommands.size() - count(CommandType::ClearScreen) - count(CommandType::ClipRect);
+}
+
+
+/**
+ * Discards recorded commands. Storage is kept for the next frame.
+ */
+void RendererRecording::clearCommands()
+{
+	mCommands.clear();
+	mCounts.fill(0);
+}
+
+
+void RendererRecording::drawImage(const Image& image, Point<float> position, float scale, Color color)
+{
+	record(CommandType::Image, image.textureId(), {position, image.size().to<float>() * scale}, color);
+}
+
+
+void RendererRecording::drawSubImage(const Image& image, Point<float> raster, const Rectangle<float>& subImageRect, Color color)
+{
+	record(CommandType::SubImage, image.textureId(), {raster, subImageRect.size}, color);
+}
+
+
+void RendererRecording::drawSubImageRotated(const Image& image, Point<float> raster, const Rectangle<float>& subImageRect, Angle /*degrees*/, Color color)
+{
+	record(CommandType::SubImageRotated, image.textureId(), {raster, subImageRect.size}, color);
+}
+
+
+void RendererRecording::drawImageRotated(const Image& image, Point<float> position, Angle /*degrees*/, Color color, float scale)
+{
+	record(CommandType::ImageRotated, image.textureId(), {position, image.size().to<float>() * scale}, color);
+}
+
+
+void RendererRecording::drawImageStretched(const Image& image, const Rectangle<float>& rect, Color color)
+{
+	record(CommandType::ImageStretched, image.textureId(), rect, color);
+}
+
+
+void RendererRecording::drawImageRepeated(const Image& image, const Rectangle<float>& rect)
+{
+	record(CommandType::ImageRepeated, image.textureId(), rect, Color::Normal);
+}
+
+
+void RendererRecording::drawSubImageRepeated(const Image& image, const Rectangle<float>& destination, const Rectangle<int>& /*source*/)
+{
+	record(CommandType::SubImageRepeated, image.textureId(), destination, Color::Normal);
+}
+
+
+void RendererRecording::drawPoint(Point<float> position, Color color)
+{
+	record(CommandType::Point, 0, {position, {1, 1}}, color);
+}
+
+
+void RendererRecording::drawLine(Point<float> startPosition, Point<float> endPosition, Color color, int /*lineWidth*/)
+{
+	record(CommandType::Line, 0, {startPosition, endPosition - startPosition}, color);
+}
+
+
+void RendererRecording::drawBox(const Rectangle<float>& rect, Color color)
+{
+	record(CommandType::Box, 0, rect, color);
+}
+
+
+void RendererRecording::drawBoxFilled(const Rectangle<float>& rect, Color color)
+{
+	record(CommandType::BoxFilled, 0, rect, color);
+}
+
+
+void RendererRecording::drawCircle(Point<float> position, float radius, Color color, int /*numSegments*/, Vector<float> scale)
+{
+	const auto radii = Vector{radius * scale.x, radius * scale.y};
+	record(CommandType::Circle, 0, {position - radii, radii * 2}, color);
+}
+
+
+void RendererRecording::drawGradient(const Rectangle<float>& rect, Color c1, Color /*c2*/, Color /*c3*/, Color /*c4*/)
+{
+	record(CommandType::Gradient, 0, rect, c1);
+}
+
+
+void RendererRecording::drawText(const Font& /*font*/, std::string_view /*text*/, Point<float> position, Color color)
+{
+	record(CommandType::Text, 0, {position, {0, 0}}, color);
+}
+
+
+void RendererRecording::clearScreen(Color color)
+{
+	record(CommandType::ClearScreen, 0, {{0, 0}, Renderer::size().to<float>()}, color);
+}
+
+
+void RendererRecording::clipRect(const Rectangle<float>& rect)
+{
+	record(CommandType::ClipRect, 0, rect, Color::Normal);
+}
+
+
+void RendererRecording::record(CommandType type, unsigned int texture, const Rectangle<float>& rect, Color color)
+{
+	mCommands.push_back({type, texture, rect, color});
+	++mCounts[static_cast<std::size_t>(type)];
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <NAS2D/Renderer/RendererNull.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * Renderer that records draw commands instead of drawing them.
+ *
+ * Nothing is sent to the graphics driver so drawing code can be timed and
+ * checked for the number of draw calls it makes without a GPU.
+ */
+class RendererRecording : public NAS2D::RendererNull
+{
+public:
+	enum class CommandType : std::uint8_t
+	{
+		Image,
+		SubImage,
+		SubImageRotated,
+		ImageRotated,
+		ImageStretched,
+		ImageRepeated,
+		SubImageRepeated,
+		Point,
+		Line,
+		Box,
+		BoxFilled,
+		Circle,
+		Gradient,
+		Text,
+		ClearScreen,
+		ClipRect,
+
+		Count
+	};
+
+	/**
+	 * A recorded draw call. Shapes and text have a texture of 0.
+	 */
+	struct Command
+	{
+		CommandType type;
+		unsigned int texture;
+		NAS2D::Rectangle<float> rect;
+		NAS2D::Color color;
+	};
+
+	RendererRecording() = default;
+
+	const std::vector<Command>& commands() const { return mCommands; }
+	std::size_t count(CommandType type) const { return mCounts[static_cast<std::size_t>(type)]; }
+	std::size_t drawCallCount() const;
+
+	void clearCommands();
+
+	void drawImage(const NAS2D::Image& image, NAS2D::Point<float> position, float scale = 1.0, NAS2D::Color color = NAS2D::Color::Normal) override;
+	void drawSubImage(const NAS2D::Image& image, NAS2D::Point<float> raster, const NAS2D::Rectangle<float>& subImageRect, NAS2D::Color color = NAS2D::Color::Normal) override;
+	void drawSubImageRotated(const NAS2D::Image& image, NAS2D::Point<float> raster, const NAS2D::Rectangle<float>& subImageRect, NAS2D::Angle degrees, NAS2D::Color color = NAS2D::Color::Normal) override;
+	void drawImageRotated(const NAS2D::Image& image, NAS2D::Point<float> position, NAS2D::Angle degrees, NAS2D::Color color = NAS2D::Color::Normal, float scale = 1.0f) override;
+	void drawImageStretched(const NAS2D::Image& image, const NAS2D::Rectangle<float>& rect, NAS2D::Color color = NAS2D::Color::Normal) override;
+	void drawImageRepeated(const NAS2D::Image& image, const NAS2D::Rectangle<float>& rect) override;
+	void drawSubImageRepeated(const NAS2D::Image& image, const NAS2D::Rectangle<float>& destination, const NAS2D::Rectangle<int>& source) override;
+
+	void drawPoint(NAS2D::Point<float> position, NAS2D::Color color = NAS2D::Color::White) override;
+	void drawLine(NAS2D::Point<float> startPosition, NAS2D::Point<float> endPosition, NAS2D::Color color = NAS2D::Color::White, int lineWidth = 1) override;
+	void drawBox(const NAS2D::Rectangle<float>& rect, NAS2D::Color color = NAS2D::Color::White) override;
+	void drawBoxFilled(const NAS2D::Rectangle<float>& rect, NAS2D::Color color = NAS2D::Color::White) override;
+	void drawCircle(NAS2D::Point<float> position, float radius, NAS2D::Color color, int numSegments = 10, NAS2D::Vector<float> scale = NAS2D::Vector<float>{1.0f, 1.0f}) override;
+	void drawGradient(const NAS2D::Rectangle<float>& rect, NAS2D::Color c1, NAS2D::Color c2, NAS2D::Color c3, NAS2D::Color c4) override;
+	void drawText(const NAS2D::Font& font, std::string_view text, NAS2D::Point<float> position, NAS2D::Color color = NAS2D::Color::White) override;
+
+	void clearScreen(NAS2D::Color color = NAS2D::Color::Black) override;
+	void clipRect(const NAS2D::Rectangle<float>& rect) override;
+
+private:
+	void record(CommandType type, unsigned int texture, const NAS2D::Rectangle<float>& rect, NAS2D::Color color);
+
+	std::vector<Command> mCommands;
+	std::array<std::size_t, static_cast<std::size_t>(CommandType::Count)> mCounts{};
+};
@@ -0,0 +1,141 @@
+#include "ResourceLedger.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace
+{
+	StructureList& storageListFor(const Structure& structure, StructureList& commandCenters, StructureList& storageTanks)
+	{
+		return (structure.structureClass() == Structure::StructureClass::Command) ? commandCenters : storageTanks;
+	}
+}
+
+
+void ResourceLedger::insert(Structure& structure)
+{
+	if (!storesRefinedResources(structure)) { return; }
+
+	storageListFor(structure, mCommandCenters, mStorageTanks).push_back(&structure);
+	mTotal += structure.storage();
+}
+
+
+void ResourceLedger::remove(Structure& structure)
+{
+	if (!storesRefinedResources(structure)) { return; }
+
+	auto& structures = storageListFor(structure, mCommandCenters, mStorageTanks);
+	const auto it = std::find(structures.begin(), structures.end(), &structure);
+	if (it == structures.end())
+	{
+		throw std::runtime_error("ResourceLedger::remove(): Structure is not tracked by the ledger");
+	}
+
+	structures.erase(it);
+	mTotal -= structure.storage();
+}
+
+
+void ResourceLedger::clear()
+{
+	mCommandCenters.clear();
+	mStorageTanks.clear();
+	mTotal = {};
+}
+
+
+/**
+ * Adds refined resources to storage structures.
+ *
+ * \return	Resources that did not fit in storage.
+ */
+StorableResources ResourceLedger::add(StorableResources resourcesToAdd)
+{
+	const auto addTo = [this, &resourcesToAdd](const StructureList& structures) {
+		for (auto* structure : structures)
+		{
+			if (resourcesToAdd.isEmpty()) { return; }
+
+			auto& storage = structure->storage();
+			const auto newResources = storage + resourcesToAdd;
+			const auto capped = newResources.cap(structure->storageCapacity() / 4);
+
+			mTotal += capped - storage;
+			storage = capped;
+			resourcesToAdd = newResources - capped;
+		}
+	};
+
+	addTo(mCommandCenters);
+	addTo(mStorageTanks);
+
+	return resourcesToAdd;
+}
+
+
+/**
+ * Removes refined resources from storage structures.
+ *
+ * \note	Assumes that enough resources are available and has already
+ *			been checked. Any amount that can't be removed is left in
+ *			\c resourcesToRemove.
+ */
+void ResourceLedger::remove(StorableResources& resourcesToRemove)
+{
+	const auto removeFrom = [this, &resourcesToRemove](const StructureList& structures) {
+		for (auto* structure : structures)
+		{
+			if (resourcesToRemove.isEmpty()) { return; }
+
+			auto& storage = structure->storage();
+			const auto toTransfer = resourcesToRemove.cap(storage);
+			storage -= toTransfer;
+			resourcesToRemove -= toTransfer;
+			mTotal -= toTransfer;
+		}
+	};
+
+	removeFrom(mStorageTanks);
+	removeFrom(mCommandCenters);
+}
+
+
+/**
+ * Removes resources from the storage of a single structure and keeps
+ * the total in step.
+ *
+ * \note	\c resourcesToRemove must not exceed what the structure stores.
+ */
+void ResourceLedger::removeFromStructure(Structure& structure, const StorableResources& resourcesToRemove)
+{
+	structure.storage() -= resourcesToRemove;
+	if (storesRefinedResources(structure)) { mTotal -= resourcesToRemove; }
+}
+
+
+/**
+ * Rebuilds the running total from the storage structures.
+ *
+ * Needed after the storage of a tracked structure is changed directly
+ * instead of through the ledger.
+ */
+void ResourceLedger::recount()
+{
+	mTotal = {};
+	for (const auto* structures : {&mCommandCenters, &mStorageTanks})
+	{
+		for (auto* structure : *structures)
+		{
+			mTotal += structure->storage();
+		}
+	}
+}
+
+
+bool ResourceLedger::storesRefinedResources(const Structure& structure)
+{
+	return structure.structureClass() == Structure::StructureClass::Command ||
+		structure.structureClass() == Structure::StructureClass::Storage;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "StorableResources.h"
+#include "MapObjects/Structure.h"
+
+
+/**
+ * Tracks the structures that store refined resources and the total they hold.
+ *
+ * The Command Center is filled first and emptied last as it acts as backup
+ * storage before storage tanks are built.
+ */
+class ResourceLedger
+{
+public:
+	void insert(Structure& structure);
+	void remove(Structure& structure);
+	void clear();
+
+	StorableResources add(StorableResources resourcesToAdd);
+	void remove(StorableResources& resourcesToRemove);
+	void removeFromStructure(Structure& structure, const StorableResources& resourcesToRemove);
+
+	void recount();
+
+	const StorableResources& total() const { return mTotal; }
+
+	static bool storesRefinedResources(const Structure& structure);
+
+private:
+	StructureList mCommandCenters;
+	StructureList mStorageTanks;
+	StorableResources mTotal;
+};
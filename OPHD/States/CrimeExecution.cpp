@@ -96,7 +96,9 @@ void CrimeExecution::stealResources(Structure& structure, const std::array<std::
 		amountStolen = structure.storage().resources[indexToStealFrom];
 	}
 
-	structure.storage().resources[indexToStealFrom] -= amountStolen;
+	StorableResources stolenResources;
+	stolenResources.resources[indexToStealFrom] = amountStolen;
+	NAS2D::Utility<StructureManager>::get().resourceLedger().removeFromStructure(structure, stolenResources);
 
 	const auto& structureTile = NAS2D::Utility<StructureManager>::get().tileFromStructure(&structure);
 
@@ -1,6 +1,7 @@
 #include "CrimeRateUpdate.h"
 
 #include "../Map/Tile.h"
+#include "../Map/OverlayLayer.h"
 #include "../MapObjects/Structure.h"
 #include "../StructureManager.h"
 
@@ -8,8 +9,10 @@
 
 #include <NAS2D/Utility.h>
 
+#include <limits>
 
-void CrimeRateUpdate::update(const std::vector<std::vector<Tile*>>& policeOverlays)
+
+void CrimeRateUpdate::update(const OverlayLayer& policeOverlay)
 {
 	mMeanCrimeRate = 0;
 	mStructuresCommittingCrimes.clear();
@@ -23,43 +26,36 @@ void CrimeRateUpdate::update(const std::vector<std::vector<Tile*>>& policeOverla
 		return;
 	}
 
-	double accumulatedCrime{0};
-
-	for (auto structure : structuresWithCrime)
+	mCrimeBatch.resize(structuresWithCrime.size());
+	for (std::size_t i = 0; i < structuresWithCrime.size(); ++i)
 	{
-		int crimeRateChange = isProtectedByPolice(policeOverlays, structure) ? -1 : 1;
-		structure->increaseCrimeRate(crimeRateChange);
+		mCrimeBatch.crimeRates[i] = structuresWithCrime[i]->crimeRate();
+		mCrimeBatch.isProtected[i] = isProtectedByPolice(policeOverlay, structuresWithCrime[i]);
+	}
+
+	// Crime Rate of 0% means no crime
+	// Crime Rate of 100% means crime occurs 10% of the time on medium difficulty
+	// chanceCrimeOccurs multiplier increases or decreases chance based on difficulty
+	const CounterRandom random{randomNumber.generate<std::uint64_t>(0, std::numeric_limits<std::uint64_t>::max())};
+	mMeanCrimeRate = updateCrimeBatch(mCrimeBatch, chanceCrimeOccurs[mDifficulty], random);
 
-		// Crime Rate of 0% means no crime
-		// Crime Rate of 100% means crime occurs 10% of the time on medium difficulty
-		// chanceCrimeOccurs multiplier increases or decreases chance based on difficulty
-		if (static_cast<int>(static_cast<float>(structure->crimeRate()) * chanceCrimeOccurs[mDifficulty]) + randomNumber.generate<int>(0, 1000) > 1000)
+	for (std::size_t i = 0; i < structuresWithCrime.size(); ++i)
+	{
+		structuresWithCrime[i]->crimeRate(mCrimeBatch.crimeRates[i]);
+		if (mCrimeBatch.commitsCrime[i])
 		{
-			mStructuresCommittingCrimes.push_back(structure);
+			mStructuresCommittingCrimes.push_back(structuresWithCrime[i]);
 		}
-
-		accumulatedCrime += structure->crimeRate();
 	}
 
-	mMeanCrimeRate = static_cast<int>(accumulatedCrime / static_cast<double>(structuresWithCrime.size()));
-
 	updateMoraleChanges();
 }
 
 
-bool CrimeRateUpdate::isProtectedByPolice(const std::vector<std::vector<Tile*>>& policeOverlays, Structure* structure)
+bool CrimeRateUpdate::isProtectedByPolice(const OverlayLayer& policeOverlay, Structure* structure)
 {
 	const auto& structureTile = NAS2D::Utility<StructureManager>::get().tileFromStructure(structure);
-
-	for (const auto& tile : policeOverlays[static_cast<std::size_t>(structureTile.depth())])
-	{
-		if (tile->xy() == structureTile.xy())
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return policeOverlay.contains(structureTile.xyz());
 }
 
 
@@ -2,6 +2,8 @@
 
 #include "../Common.h"
 
+#include <libOPHD/CrimeSimulation.h>
+
 #include <vector>
 #include <map>
 #include <string>
@@ -9,13 +11,13 @@
 
 
 class Structure;
-class Tile;
+class OverlayLayer;
 
 
 class CrimeRateUpdate
 {
 public:
-	void update(const std::vector<std::vector<Tile*>>& policeOverlays);
+	void update(const OverlayLayer& policeOverlay);
 
 	int meanCrimeRate() const { return mMeanCrimeRate; }
 	std::vector<std::pair<std::string, int>> moraleChanges() const { return mMoraleChanges; }
@@ -36,8 +38,9 @@ private:
 	int mMeanCrimeRate{0};
 	std::vector<std::pair<std::string, int>> mMoraleChanges;
 	std::vector<Structure*> mStructuresCommittingCrimes;
+	CrimeBatch mCrimeBatch;
 
-	bool isProtectedByPolice(const std::vector<std::vector<Tile*>>& policeOverlays, Structure* structure);
+	bool isProtectedByPolice(const OverlayLayer& policeOverlay, Structure* structure);
 	int calculateMoraleChange();
 	void updateMoraleChanges();
 };
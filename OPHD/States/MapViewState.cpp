@@ -9,6 +9,7 @@
 #include "../Constants/UiConstants.h"
 
 #include "../DirectionOffset.h"
+#include "../RendererCounting.h"
 #include "../Cache.h"
 #include "../ProductCatalogue.h"
 #include "../StructureCatalogue.h"
@@ -21,12 +22,13 @@
 #include "../UI/MessageBox.h"
 
 #include <NAS2D/Utility.h>
+#include <NAS2D/Filesystem.h>
 #include <NAS2D/EventHandler.h>
 #include <NAS2D/Renderer/Renderer.h>
-#include <NAS2D/Math/PointInRectangleRange.h>
 
 #include <algorithm>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 
@@ -59,68 +61,26 @@ namespace
 	};
 
 
-	NAS2D::Point<int> clampPointToRect(NAS2D::Point<int> point, const NAS2D::Rectangle<int>& rect)
-	{
-		const auto endPoint = rect.endPoint();
-		return {
-			std::clamp(point.x, rect.position.x, endPoint.x),
-			std::clamp(point.y, rect.position.y, endPoint.y),
-		};
-	}
-
-
-	NAS2D::Rectangle<int> buildTileRectFromCenter(const NAS2D::Point<int>& centerPoint, int radius)
-	{
-		const auto mapRect = NAS2D::Rectangle<int>{{0, 0}, {299, 149}};
-		const auto offset = NAS2D::Vector{radius, radius};
-		const auto areaStartPoint = clampPointToRect(centerPoint - offset, mapRect);
-		const auto areaEndPoint = clampPointToRect(centerPoint + offset + NAS2D::Vector{1, 1}, mapRect);
-		return NAS2D::Rectangle<int>::Create(areaStartPoint, areaEndPoint);
-	}
-
-
-	void fillOverlayCircle(TileMap& tileMap, std::vector<Tile*>& tileList, Tile& centerTile, int range)
-	{
-		const auto center = centerTile.xy();
-		const auto depth = centerTile.depth();
-		auto tileRect = buildTileRectFromCenter(center, range);
-
-		for (const auto point : NAS2D::PointInRectangleRange(tileRect))
-		{
-			if (isPointInRange(center, point, range))
-			{
-				auto& tile = tileMap.getTile({point, depth});
-				if (std::find(tileList.begin(), tileList.end(), &tile) == tileList.end())
-				{
-					tileList.push_back(&tile);
-				}
-			}
-		}
-	}
-
-
-	template <typename StructureType>
-	void fillOverlay(TileMap& tileMap, std::vector<Tile*>& overlay, const std::vector<StructureType*> structures)
+	/**
+	 * Coverage radius of a comm range or police source, or -1 if the
+	 * structure covers nothing.
+	 */
+	int coverageRange(const Structure& structure)
 	{
-		auto& structureManager = NAS2D::Utility<StructureManager>::get();
-		for (auto structure : structures)
-		{
-			if (!structure->operational()) { continue; }
-			auto& centerTile = structureManager.tileFromStructure(structure);
-			fillOverlayCircle(tileMap, overlay, centerTile, structure->getRange());
-		}
-	}
-
+		if (!structure.operational()) { return -1; }
 
-	template <typename StructureType>
-	void fillOverlay(TileMap& tileMap, std::vector<std::vector<Tile*>>& overlays, const std::vector<StructureType*> structures)
-	{
-		auto& structureManager = NAS2D::Utility<StructureManager>::get();
-		for (auto structure : structures)
+		switch (structure.structureClass())
 		{
-			if (!structure->operational()) { continue; }
-			auto& centerTile = structureManager.tileFromStructure(structure);
-			fillOverlayCircle(tileMap, overlays[static_cast<std::size_t>(centerTile.depth())], centerTile, structure->getRange());
+		case Structure::StructureClass::Command:
+			return static_cast<const CommandCenter&>(structure).getRange();
+		case Structure::StructureClass::Communication:
+			return static_cast<const CommTower&>(structure).getRange();
+		case Structure::StructureClass::SurfacePolice:
+			return static_cast<const SurfacePolice&>(structure).getRange();
+		case Structure::StructureClass::UndergroundPolice:
+			return static_cast<const UndergroundPolice&>(structure).getRange();
+		default:
+			return -1;
 		}
 	}
 
@@ -129,7 +89,7 @@ namespace
 	{
 		const auto robotLocationText = "(" + std::to_string(position.xy.x) + ", " + std::to_string(position.xy.y) + ")";
 
-		if (robot->fuelCellAge() == 190) // FIXME: magic number
+		if (robot->fuelCellAge() == constants::RobotAgingWarningAge)
 		{
 			notificationArea.push({
 				"Aging Robot",
@@ -137,7 +97,7 @@ namespace
 				position,
 				NotificationArea::NotificationType::Warning});
 		}
-		else if (robot->fuelCellAge() == 195) // FIXME: magic number
+		else if (robot->fuelCellAge() == constants::RobotAgingCriticalAge)
 		{
 			notificationArea.push({
 				"Aging Robot",
@@ -162,6 +122,7 @@ MapViewState::MapViewState(MainReportsUiState& mainReportsState, const std::stri
 	mLoadingExisting(true),
 	mExistingToLoad(savegame),
 	mMainReportsState(mainReportsState),
+	mFont{fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal)},
 	mResourceInfoBar{mResourcesCount, mPopulation, mCurrentMorale, mPreviousMorale, mFood},
 	mRobotDeploymentSummary{mRobotPool}
 {
@@ -177,6 +138,7 @@ MapViewState::MapViewState(MainReportsUiState& mainReportsState, const Planet::A
 	mPlanetAttributes(planetAttributes),
 	mMainReportsState(mainReportsState),
 	mMapView{std::make_unique<MapView>(*mTileMap)},
+	mFont{fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal)},
 	mResourceInfoBar{mResourcesCount, mPopulation, mCurrentMorale, mPreviousMorale, mFood},
 	mRobotDeploymentSummary{mRobotPool},
 	mMiniMap{std::make_unique<MiniMap>(*mMapView, mTileMap, mRobotList, planetAttributes.mapImagePath)},
@@ -211,6 +173,11 @@ MapViewState::~MapViewState()
 
 	eventHandler.textInputMode(false);
 
+	auto& structureManager = NAS2D::Utility<StructureManager>::get();
+	structureManager.structureAdded().disconnect({this, &MapViewState::onStructureCoverageChanged});
+	structureManager.structureStateChanged().disconnect({this, &MapViewState::onStructureCoverageChanged});
+	structureManager.structureRemoved().disconnect({this, &MapViewState::onStructureRemoved});
+
 	NAS2D::Utility<std::map<class MineFacility*, Route>>::get().clear();
 }
 
@@ -238,15 +205,24 @@ void MapViewState::initialize()
 	StructureCatalogue::init();
 	ProductCatalogue::init("factory_products.xml");
 
+	// Coverage follows structures as they are built, change state or are removed
+	auto& structureManager = NAS2D::Utility<StructureManager>::get();
+	structureManager.structureAdded().connect({this, &MapViewState::onStructureCoverageChanged});
+	structureManager.structureStateChanged().connect({this, &MapViewState::onStructureCoverageChanged});
+	structureManager.structureRemoved().connect({this, &MapViewState::onStructureRemoved});
+
 	if (mLoadingExisting)
 	{
 		load(mExistingToLoad);
 	}
+	else
+	{
+		resetCoverage();
+	}
 
 	mResourceInfoBar.ignoreGlow(mTurnCount == 0);
 
 	setupUiPositions(renderer.size());
-	resetPoliceOverlays();
     
     mMainReportsState.injectTechnology(mTechnologyReader, mResearchTracker);
 
@@ -309,6 +285,10 @@ NAS2D::State* MapViewState::update()
 	auto& renderer = NAS2D::Utility<NAS2D::Renderer>::get();
 	const auto windowClientRect = NAS2D::Rectangle{{0, 0}, renderer.size()};
 
+	auto* drawCallCounter = dynamic_cast<DrawCallCounter*>(&renderer);
+	if (drawCallCounter) { drawCallCounter->resetCounts(); }
+	mFrameProfiler.beginFrame();
+
 	// Game's over, don't bother drawing anything else
 	if (mGameOverDialog.visible())
 	{
@@ -327,8 +307,15 @@ NAS2D::State* MapViewState::update()
 		mDetailMap->onMouseMove(MOUSE_COORDS);
 	}
 
-	mDetailMap->update();
-	mDetailMap->draw();
+	{
+		FrameProfiler::Scope scope{mFrameProfiler, FrameProfiler::Phase::MapUpdate};
+		mDetailMap->update();
+	}
+
+	{
+		FrameProfiler::Scope scope{mFrameProfiler, FrameProfiler::Phase::MapDraw};
+		mDetailMap->draw();
+	}
 
 	// FIXME: Ugly / hacky
 	if (modalUiElementDisplayed())
@@ -336,29 +323,23 @@ NAS2D::State* MapViewState::update()
 		renderer.drawBoxFilled(windowClientRect, NAS2D::Color{0, 0, 0, 165});
 	}
 
-	drawUI();
+	{
+		FrameProfiler::Scope scope{mFrameProfiler, FrameProfiler::Phase::UiDraw};
+		drawUI();
+	}
 
 	updateFade(renderer, mFade);
 
+	if (mFrameProfilerVisible) { drawFrameProfiler(); }
+	mFrameProfiler.endFrame(drawCallCounter ? drawCallCounter->drawCalls() : 0, drawCallCounter ? drawCallCounter->textureBinds() : 0);
+
 	return this;
 }
 
 
 void MapViewState::updatePlayerResources()
 {
-	auto& storageTanks = NAS2D::Utility<StructureManager>::get().getStructures<StorageTanks>();
-	auto& command = NAS2D::Utility<StructureManager>::get().getStructures<CommandCenter>();
-
-	std::vector<Structure*> storage;
-	storage.insert(storage.end(), command.begin(), command.end());
-	storage.insert(storage.end(), storageTanks.begin(), storageTanks.end());
-
-	StorableResources resources;
-	for (auto structure : storage)
-	{
-		resources += structure->storage();
-	}
-	mResourcesCount = resources;
+	mResourcesCount = NAS2D::Utility<StructureManager>::get().resourceLedger().total();
 }
 
 
@@ -469,6 +450,10 @@ void MapViewState::onKeyDown(NAS2D::EventHandler::KeyCode key, NAS2D::EventHandl
 			}
 			break;
 
+		case NAS2D::EventHandler::KeyCode::KEY_F11:
+			toggleFrameProfiler();
+			break;
+
 		case NAS2D::EventHandler::KeyCode::KEY_F2:
 			mFileIoDialog.scanDirectory(constants::SaveGamePath);
 			mFileIoDialog.setMode(FileIo::FileOperation::Save);
@@ -496,6 +481,31 @@ void MapViewState::onKeyDown(NAS2D::EventHandler::KeyCode key, NAS2D::EventHandl
 }
 
 
+/**
+ * Shows or hides the frame profiler and starts or stops
+ * logging its samples to the user's pref path.
+ */
+void MapViewState::toggleFrameProfiler()
+{
+	mFrameProfilerVisible = !mFrameProfilerVisible;
+	if (mFrameProfilerVisible)
+	{
+		try
+		{
+			mFrameProfiler.startLog((NAS2D::Utility<NAS2D::Filesystem>::get().prefPath() / "frame_profile.csv").string());
+		}
+		catch (const std::runtime_error& e)
+		{
+			doNonFatalErrorMessage("Frame Profiler", e.what());
+		}
+	}
+	else
+	{
+		mFrameProfiler.stopLog();
+	}
+}
+
+
 void MapViewState::onMouseDown(NAS2D::EventHandler::MouseButton button, NAS2D::Point<int> position)
 {
 	if (!active()) { return; }
@@ -563,7 +573,7 @@ void MapViewState::onMouseDoubleClick(NAS2D::EventHandler::MouseButton button, N
 		const auto tilePosition = mDetailMap->mouseTilePosition();
 		if (!mTileMap->isValidPosition(tilePosition)) { return; }
 
-		auto& tile = mTileMap->getTile(tilePosition);
+		const auto& tile = std::as_const(*mTileMap).getTile(tilePosition);
 		if (tile.thingIsStructure())
 		{
 			Structure* structure = tile.structure();
@@ -716,11 +726,6 @@ void MapViewState::onSystemMenu()
  */
 void MapViewState::changeViewDepth(int depth)
 {
-	if (mBtnTogglePoliceOverlay.isPressed())
-	{
-		changePoliceOverlayDepth(mMapView->currentDepth(), depth);
-	}
-
 	mMapView->currentDepth(depth);
 
 	if (mInsertMode != InsertMode::Robot) { clearMode(); }
@@ -1002,15 +1007,6 @@ void MapViewState::placeRobodozer(Tile& tile)
 			else { return; }
 		}
 
-		if (structure->structureClass() == Structure::StructureClass::Communication)
-		{
-			updateCommRangeOverlay();
-		}
-		if (structure->isPolice())
-		{
-			updatePoliceOverlay();
-		}
-
 		const auto& recycledResources = StructureCatalogue::recyclingValue(structure->structureId());
 		const auto& wastedResources = addRefinedResources(recycledResources);
 
@@ -1034,6 +1030,7 @@ void MapViewState::placeRobodozer(Tile& tile)
 	auto& robot = mRobotPool.getDozer();
 	robot.startTask(tile);
 	mRobotPool.insertRobotIntoTable(mRobotList, robot, tile);
+	scheduleRobotAgingEvents(robot);
 
 	if (!mRobotPool.robotAvailable(Robot::Type::Dozer))
 	{
@@ -1053,7 +1050,7 @@ void MapViewState::placeRobodigger(Tile& tile)
 	}
 
 	// Check for obstructions underneath the the digger location.
-	if (tile.depth() != mTileMap->maxDepth() && !mTileMap->getTile({tile.xy(), tile.depth() + 1}).empty())
+	if (tile.depth() != mTileMap->maxDepth() && !std::as_const(*mTileMap).getTile({tile.xy(), tile.depth() + 1}).empty())
 	{
 		doAlertMessage(constants::AlertInvalidRobotPlacement, constants::AlertDiggerBlockedBelow);
 		return;
@@ -1144,6 +1141,7 @@ void MapViewState::placeRobominer(Tile& tile)
 	auto& robot = mRobotPool.getMiner();
 	robot.startTask(tile);
 	mRobotPool.insertRobotIntoTable(mRobotList, robot, tile);
+	scheduleRobotAgingEvents(robot);
 
 	if (!mRobotPool.robotAvailable(Robot::Type::Miner))
 	{
@@ -1230,18 +1228,21 @@ void MapViewState::insertSeedLander(NAS2D::Point<int> point)
  */
 void MapViewState::updateRobots()
 {
+	for (auto& [robot, tile] : mRobotList)
+	{
+		robot->update();
+	}
+
+	mRobotAgingEvents.advance([this](Robot* robot) { dispatchRobotAgingEvent(robot); });
+
 	auto robot_it = mRobotList.begin();
 	while (robot_it != mRobotList.end())
 	{
 		auto robot = robot_it->first;
 		auto tile = robot_it->second;
 
-		robot->update();
-
 		const auto& position = tile->xyz();
 
-		pushAgingRobotMessage(robot, position, mNotificationArea);
-
 		if (robot->isDead())
 		{
 			const auto robotLocationText = "(" +  std::to_string(position.xy.x) + ", " + std::to_string(position.xy.y) + ")";
@@ -1337,34 +1338,102 @@ void MapViewState::updateConnectedness()
 {
 	auto& structureManager = NAS2D::Utility<StructureManager>::get();
 	structureManager.updateConnectedness(*mTileMap);
-	mConnectednessOverlay = structureManager.getConnectednessOverlay();
+
+	resetOverlay(mConnectednessOverlay);
+	for (const auto* tile : structureManager.getConnectednessOverlay())
+	{
+		mConnectednessOverlay.set(tile->xyz());
+	}
 }
 
 
-void MapViewState::updateCommRangeOverlay()
+/**
+ * Schedules the fuel cell aging warnings of a robot that was just put
+ * to work.
+ *
+ * \note	Robots only age while working so any events left over from a
+ *			previous task are cancelled first.
+ */
+void MapViewState::scheduleRobotAgingEvents(Robot& robot)
 {
-	mCommRangeOverlay.clear();
+	mRobotAgingEvents.cancelIf([&robot](const Robot* event) { return event == &robot; });
 
-	auto& structureManager = NAS2D::Utility<StructureManager>::get();
-	fillOverlay(*mTileMap, mCommRangeOverlay, structureManager.getStructures<CommandCenter>());
-	fillOverlay(*mTileMap, mCommRangeOverlay, structureManager.getStructures<CommTower>());
+	for (const auto age : {constants::RobotAgingWarningAge, constants::RobotAgingCriticalAge})
+	{
+		const auto turnsRemaining = age - robot.fuelCellAge();
+		if (turnsRemaining > 0)
+		{
+			mRobotAgingEvents.schedule(mRobotAgingEvents.tick() + static_cast<std::uint64_t>(turnsRemaining), &robot);
+		}
+	}
 }
 
 
-void MapViewState::updatePoliceOverlay()
+void MapViewState::dispatchRobotAgingEvent(Robot* robot)
 {
-	resetPoliceOverlays();
+	const auto it = mRobotList.find(robot);
+	if (it == mRobotList.end()) { return; }
 
-	auto& structureManager = NAS2D::Utility<StructureManager>::get();
-	fillOverlay(*mTileMap, mPoliceOverlays[0], structureManager.getStructures<SurfacePolice>());
-	fillOverlay(*mTileMap, mPoliceOverlays, structureManager.getStructures<UndergroundPolice>());
+	pushAgingRobotMessage(robot, it->second->xyz(), mNotificationArea);
+}
+
+
+/**
+ * Returns the coverage grid a structure contributes to, or nullptr if it
+ * is not a comm range or police source.
+ */
+CoverageGrid* MapViewState::coverageGrid(const Structure& structure)
+{
+	switch (structure.structureClass())
+	{
+	case Structure::StructureClass::Command:
+	case Structure::StructureClass::Communication:
+		return &mCommRangeCoverage;
+	case Structure::StructureClass::SurfacePolice:
+	case Structure::StructureClass::UndergroundPolice:
+		return &mPoliceCoverage;
+	default:
+		return nullptr;
+	}
+}
+
+
+/**
+ * Updates the coverage of a structure that was added or changed state.
+ */
+void MapViewState::onStructureCoverageChanged(Structure& structure)
+{
+	auto* coverage = coverageGrid(structure);
+	if (!coverage) { return; }
+
+	const auto& tile = NAS2D::Utility<StructureManager>::get().tileFromStructure(&structure);
+	coverage->updateSource(&structure, tile.xyz(), coverageRange(structure));
+}
+
+
+void MapViewState::onStructureRemoved(Structure& structure)
+{
+	auto* coverage = coverageGrid(structure);
+	if (coverage) { coverage->removeSource(&structure); }
+}
+
+
+/**
+ * Clears an overlay and sizes it to fit the current map.
+ */
+void MapViewState::resetOverlay(OverlayLayer& overlay)
+{
+	overlay.reset(mTileMap->size(), mTileMap->maxDepth() + 1);
 }
 
 
-void MapViewState::resetPoliceOverlays()
+/**
+ * Clears comm range and police coverage and sizes it to fit the current map.
+ */
+void MapViewState::resetCoverage()
 {
-	const auto adjustedZ = mTileMap->maxDepth() + 1;
-	mPoliceOverlays = std::vector<std::vector<Tile*>>(static_cast<std::size_t>(adjustedZ));
+	mCommRangeCoverage.reset(mTileMap->size(), mTileMap->maxDepth() + 1);
+	mPoliceCoverage.reset(mTileMap->size(), mTileMap->maxDepth() + 1);
 }
 
 
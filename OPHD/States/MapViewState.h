@@ -10,15 +10,18 @@
 #include "../Constants/Numbers.h"
 #include "../Constants/UiConstants.h"
 
+#include "../AllocationCounter.h"
 #include "../Common.h"
 #include "../StorableResources.h"
 #include "../RobotPool.h"
 #include "../PopulationPool.h"
-#include "../Population/Population.h"
 
 #include "../Technology/ResearchTracker.h"
 #include "../Technology/TechnologyCatalog.h"
 
+#include "../Map/CoverageGrid.h"
+#include "../Map/OverlayLayer.h"
+
 #include "../MapObjects/Robot.h"
 #include "../MapObjects/Structure.h"
 
@@ -45,6 +48,10 @@
 #include "../UI/NavControl.h"
 #include "../UI/CheatMenu.h"
 
+#include <libOPHD/FrameProfiler.h>
+#include <libOPHD/TimerWheel.h>
+#include <libOPHD/Population/Population.h>
+
 #include <libControls/WindowStack.h>
 #include <libControls/ToolTip.h>
 
@@ -166,6 +173,8 @@ private:
 	// DRAWING FUNCTIONS
 	void drawUI();
 	void drawSystemButton() const;
+	void drawFrameProfiler() const;
+	void toggleFrameProfiler();
 
 	// INSERT OBJECT HANDLING
 	void onDeployCargoLander();
@@ -190,9 +199,11 @@ private:
 	void updateFood();
 	void transferFoodToCommandCenter();
 
-	void updateCommRangeOverlay();
-	void updatePoliceOverlay();
-	void resetPoliceOverlays();
+	CoverageGrid* coverageGrid(const Structure& structure);
+	void onStructureCoverageChanged(Structure& structure);
+	void onStructureRemoved(Structure& structure);
+	void resetOverlay(OverlayLayer& overlay);
+	void resetCoverage();
 	void updateConnectedness();
 	void changeViewDepth(int);
 
@@ -216,8 +227,9 @@ private:
 	void updateResidentialCapacity();
 	void updateBiowasteRecycling();
 	void updateResources();
-	void updateRoads();
 	void updateRobots();
+	void scheduleRobotAgingEvents(Robot& robot);
+	void dispatchRobotAgingEvent(Robot* robot);
 
 	void findMineRoutes();
 	void transportOreFromMines();
@@ -259,11 +271,9 @@ private:
 
 	// UI EVENT HANDLERS
 	void onTurns();
-	void setOverlay(std::vector<Tile*>& tileList, Tile::Overlay overlay);
+	void setOverlay(const OverlayLayer& overlay, Tile::Overlay overlayType);
 	void clearOverlays();
-	void clearOverlay(std::vector<Tile*>& tileList);
 	void updateOverlays();
-	void changePoliceOverlayDepth(int oldDepth, int newDepth);
 	void onToggleHeightmap();
 	void onToggleConnectedness();
 	void onToggleCommRangeOverlay();
@@ -319,6 +329,7 @@ private:
 	PopulationPool mPopulationPool;
 
 	RobotTileTable mRobotList; /**< List of active robots and their positions on the map. */
+	TimerWheel<Robot*> mRobotAgingEvents; /**< Robot fuel cell aging warnings keyed by turn. */
 	Population mPopulation;
 
 	// ROUTING
@@ -331,6 +342,7 @@ private:
 	std::unique_ptr<MapView> mMapView;
 
 	const NAS2D::Image mUiIcons{"ui/icons.png"}; /**< User interface icons. */
+	const NAS2D::Font& mFont;
 	const NAS2D::Image mBackground{"sys/bg1.png"}; /**< Background image drawn behind the tile map. */
 
 	MapCoordinate mMouseTilePosition;
@@ -385,10 +397,10 @@ private:
 	ReportsUiSignal mReportsUiSignal;
 	MapChangedSignal mMapChangedSignal;
 
-	std::vector<Tile*> mConnectednessOverlay;
-	std::vector<Tile*> mCommRangeOverlay;
-	std::vector<std::vector<Tile*>> mPoliceOverlays;
-	std::vector<Tile*> mTruckRouteOverlay;
+	OverlayLayer mConnectednessOverlay;
+	CoverageGrid mCommRangeCoverage;
+	CoverageGrid mPoliceCoverage;
+	OverlayLayer mTruckRouteOverlay;
 
 	ResourceInfoBar mResourceInfoBar;
 	RobotDeploymentSummary mRobotDeploymentSummary;
@@ -397,4 +409,7 @@ private:
 	std::unique_ptr<NavControl> mNavControl;
 
 	NAS2D::Fade mFade;
+
+	FrameProfiler mFrameProfiler{240, allocationCount};
+	bool mFrameProfilerVisible{false};
 };
@@ -8,7 +8,6 @@
 
 #include "../Constants/UiConstants.h"
 #include "../Common.h"
-#include "../Cache.h"
 #include "../Mine.h"
 #include "../StructureManager.h"
 #include "../Map/TileMap.h"
@@ -19,10 +18,23 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <iomanip>
+#include <sstream>
 
 extern NAS2D::Point<int> MOUSE_COORDS;
 
 
+namespace
+{
+	std::string formatMilliseconds(double milliseconds)
+	{
+		std::ostringstream stream;
+		stream << std::fixed << std::setprecision(2) << milliseconds << " ms";
+		return stream.str();
+	}
+}
+
+
 void MapViewState::drawSystemButton() const
 {
 	auto& renderer = NAS2D::Utility<NAS2D::Renderer>::get();
@@ -33,8 +45,7 @@ void MapViewState::drawSystemButton() const
 	// Turns
 	const auto turnImageRect = NAS2D::Rectangle<int>{{128, 0}, {constants::ResourceIconSize, constants::ResourceIconSize}};
 	renderer.drawSubImage(mUiIcons, position, turnImageRect);
-	const auto& font = fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal);
-	renderer.drawText(font, std::to_string(mTurnCount), position + textOffset, NAS2D::Color::White);
+	renderer.drawText(mFont, std::to_string(mTurnCount), position + textOffset, NAS2D::Color::White);
 
 	position = mTooltipSystemButton.rect().position + NAS2D::Vector{constants::MarginTight, constants::MarginTight};
 	bool isMouseInMenu = mTooltipSystemButton.rect().contains(MOUSE_COORDS);
@@ -42,3 +53,40 @@ void MapViewState::drawSystemButton() const
 	const auto menuImageRect = NAS2D::Rectangle<int>{{menuGearHighlightOffsetX, 32}, {constants::ResourceIconSize, constants::ResourceIconSize}};
 	renderer.drawSubImage(mUiIcons, position, menuImageRect);
 }
+
+
+void MapViewState::drawFrameProfiler() const
+{
+	if (mFrameProfiler.frameCount() == 0) { return; }
+
+	auto& renderer = NAS2D::Utility<NAS2D::Renderer>::get();
+	const auto& font = mFont;
+	const auto& frame = mFrameProfiler.lastFrame();
+
+	std::vector<std::pair<std::string, std::string>> lines{
+		{"Frame p50", formatMilliseconds(mFrameProfiler.frameTimePercentile(50))},
+		{"Frame p95", formatMilliseconds(mFrameProfiler.frameTimePercentile(95))},
+		{"Frame p99", formatMilliseconds(mFrameProfiler.frameTimePercentile(99))},
+	};
+	for (std::size_t i = 0; i < FrameProfiler::PhaseCount; ++i)
+	{
+		lines.push_back({FrameProfiler::phaseName(static_cast<FrameProfiler::Phase>(i)), formatMilliseconds(frame.phaseTimes[i])});
+	}
+	lines.push_back({"Draw calls", std::to_string(frame.drawCalls)});
+	lines.push_back({"Texture binds", std::to_string(frame.textureBinds)});
+	lines.push_back({"Allocations", std::to_string(frame.allocations)});
+
+	constexpr int valueOffset = 100;
+	const auto lineHeight = font.height();
+	const auto boxSize = NAS2D::Vector{valueOffset + 80, static_cast<int>(lines.size()) * lineHeight + constants::Margin * 2};
+	const auto boxRect = NAS2D::Rectangle{{constants::Margin, constants::ResourceIconSize + constants::Margin * 3}, boxSize};
+	renderer.drawBoxFilled(boxRect, NAS2D::Color{0, 0, 0, 180});
+
+	auto position = boxRect.position + NAS2D::Vector{constants::Margin, constants::Margin};
+	for (const auto& [label, value] : lines)
+	{
+		renderer.drawText(font, label, position, NAS2D::Color::White);
+		renderer.drawText(font, value, position + NAS2D::Vector{valueOffset, 0}, NAS2D::Color::White);
+		position.y += lineHeight;
+	}
+}
@@ -62,8 +62,8 @@ void MapViewState::onFactoryProductionComplete(Factory& factory)
 	case ProductType::PRODUCT_CLOTHING:
 	case ProductType::PRODUCT_MEDICINE:
 		{
-			Warehouse* warehouse = getAvailableWarehouse(productType, 1);
-			if (warehouse) { warehouse->products().store(productType, 1); factory.pullProduct(); }
+			auto& warehouseInventory = NAS2D::Utility<StructureManager>::get().warehouseInventory();
+			if (warehouseInventory.store(productType, 1)) { factory.pullProduct(); }
 			else 
 			{
 				factory.idle(IdleReason::FactoryInsufficientWarehouseSpace); 
@@ -101,6 +101,7 @@ void MapViewState::onDeployCargoLander()
 	auto cc = static_cast<CommandCenter*>(mTileMap->getTile({ccLocation(), 0}).structure());
 	cc->foodLevel(cc->foodLevel() + 125);
 	cc->storage() += StorableResources{25, 25, 15, 15};
+	NAS2D::Utility<StructureManager>::get().resourceLedger().recount();
 
 	updateStructuresAvailability();
 }
@@ -45,7 +45,7 @@ NAS2D::Point<int>& ccLocation()
 /**
  * Checks to see if a given tube connection is valid.
  */
-bool checkTubeConnection(Tile& tile, Direction dir, ConnectorDir sourceConnectorDir)
+bool checkTubeConnection(const Tile& tile, Direction dir, ConnectorDir sourceConnectorDir)
 {
 	if (tile.mine() || !tile.bulldozed() || !tile.excavated() || !tile.thingIsStructure())
 	{
@@ -78,7 +78,7 @@ bool checkTubeConnection(Tile& tile, Direction dir, ConnectorDir sourceConnector
 /**
  * Checks to see if the given tile offers a proper connection for a Structure.
  */
-bool checkStructurePlacement(Tile& tile, Direction dir)
+bool checkStructurePlacement(const Tile& tile, Direction dir)
 {
 	Structure* structure = tile.structure();
 	if (tile.mine() || !tile.bulldozed() || !tile.excavated() || !tile.thingIsStructure() || !structure->connected() || !structure->isConnector())
@@ -97,7 +97,7 @@ bool checkStructurePlacement(Tile& tile, Direction dir)
 /**
  * Checks to see if a tile is a valid tile to place a tube onto.
  */
-bool validTubeConnection(TileMap& tilemap, MapCoordinate position, ConnectorDir dir)
+bool validTubeConnection(const TileMap& tilemap, MapCoordinate position, ConnectorDir dir)
 {
 	return std::any_of(AllDirections4.begin(), AllDirections4.end(), [&](Direction direction){
 		return checkTubeConnection(tilemap.getTile(position.translate(direction)), direction, dir);
@@ -108,7 +108,7 @@ bool validTubeConnection(TileMap& tilemap, MapCoordinate position, ConnectorDir
 /**
  * Checks a tile to see if a valid Tube connection is available for Structure placement.
  */
-bool validStructurePlacement(TileMap& tilemap, MapCoordinate position)
+bool validStructurePlacement(const TileMap& tilemap, MapCoordinate position)
 {
 	return std::any_of(AllDirections4.begin(), AllDirections4.end(), [&](Direction direction){
 		return checkStructurePlacement(tilemap.getTile(position.translate(direction)), direction);
@@ -204,39 +204,13 @@ bool inCommRange(NAS2D::Point<int> position)
 {
 	auto& structureManager = NAS2D::Utility<StructureManager>::get();
 
-	const auto& seedLanders = structureManager.getStructures<SeedLander>();
-	for (auto lander : seedLanders)
-	{
-		if (!lander->operational()) { continue; }
-		if (isPointInRange(position, structureManager.tileFromStructure(lander).xy(), 5)) // \fixme magic number
-		{
-			return true;
-		}
-	}
-
-	const auto& command = structureManager.getStructures<CommandCenter>();
-	for (auto cc : command)
-	{
-		if (!cc->operational()) { continue; }
-
-		if (isPointInRange(position, structureManager.tileFromStructure(cc).xy(), cc->getRange()))
-		{
-			return true;
-		}
-	}
-
-	const auto& commTowers = structureManager.getStructures<CommTower>();
-	for (auto tower : commTowers)
-	{
-		if (!tower->operational()) { continue; }
+	const auto surfacePosition = MapCoordinate{position, 0};
+	const auto isOperational = [](const Structure& structure) { return structure.operational(); };
 
-		if (isPointInRange(position, structureManager.tileFromStructure(tower).xy(), tower->getRange()))
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return
+		structureManager.findStructureInRange<SeedLander>(surfacePosition, constants::LanderCommRange, isOperational) ||
+		structureManager.findStructureInRange<CommandCenter>(surfacePosition, constants::RobotCommRange, isOperational) ||
+		structureManager.findStructureInRange<CommTower>(surfacePosition, constants::CommTowerRange, isOperational);
 }
 
 
@@ -258,20 +232,7 @@ bool isPointInRange(NAS2D::Point<int> point1, NAS2D::Point<int> point2, int dist
  */
 Warehouse* getAvailableWarehouse(ProductType type, std::size_t count)
 {
-	for (auto warehouse : NAS2D::Utility<StructureManager>::get().getStructures<Warehouse>())
-	{
-		if (!warehouse->operational())
-		{
-			continue;
-		}
-
-		if (warehouse->products().canStore(type, static_cast<int>(count)))
-		{
-			return warehouse;
-		}
-	}
-
-	return nullptr;
+	return NAS2D::Utility<StructureManager>::get().warehouseInventory().findStorage(type, static_cast<int>(count));
 }
 
 
@@ -317,17 +278,25 @@ bool simulateMoveProducts(Warehouse* sourceWarehouse)
  */
 void moveProducts(Warehouse* sourceWarehouse)
 {
-	const auto& warehouses = NAS2D::Utility<StructureManager>::get().getStructures<Warehouse>();
+	auto& structureManager = NAS2D::Utility<StructureManager>::get();
+	auto& inventory = structureManager.warehouseInventory();
+
+	const auto& warehouses = structureManager.getStructures<Warehouse>();
 	for (auto warehouse : warehouses)
 	{
+		if (sourceWarehouse->products().empty()) { break; }
+
 		if (warehouse->operational())
 		{
 			if (warehouse != sourceWarehouse)
 			{
 				sourceWarehouse->products().transferAllTo(warehouse->products());
+				inventory.update(*warehouse);
 			}
 		}
 	}
+
+	inventory.update(*sourceWarehouse);
 }
 
 
@@ -354,37 +323,12 @@ void resourceShortageMessage(const StorableResources& resources, StructureID sid
 
 /**
  * Add refined resources to the players storage structures.
+ *
+ * \return	Resources that did not fit in storage.
  */
 StorableResources addRefinedResources(StorableResources resourcesToAdd)
 {
-	/**
-	 * The Command Center acts as backup storage especially during the beginning of the
-	 * game before storage tanks are built. This ensure that the CC is in the storage
-	 * structure list and that it's always the first structure in the list.
-	 */
-
-	auto& command = NAS2D::Utility<StructureManager>::get().getStructures<CommandCenter>();
-	auto& storageTanks = NAS2D::Utility<StructureManager>::get().getStructures<StorageTanks>();
-
-	std::vector<Structure*> storage;
-	storage.insert(storage.end(), command.begin(), command.end());
-	storage.insert(storage.end(), storageTanks.begin(), storageTanks.end());
-
-	for (auto structure : storage)
-	{
-		if (resourcesToAdd.isEmpty()) { break; }
-
-		auto& storageTanksResources = structure->storage();
-
-		auto newResources = storageTanksResources + resourcesToAdd;
-		auto capped = newResources.cap(structure->storageCapacity() / 4);
-
-		storageTanksResources = capped;
-		resourcesToAdd = newResources - capped;
-	}
-
-	// Return remaining unstored refined resources
-	return resourcesToAdd;
+	return NAS2D::Utility<StructureManager>::get().resourceLedger().add(resourcesToAdd);
 }
 
 
@@ -396,22 +340,5 @@ StorableResources addRefinedResources(StorableResources resourcesToAdd)
  */
 void removeRefinedResources(StorableResources& resourcesToRemove)
 {
-	// Command Center is backup storage, we want to pull from it last
-
-	auto& command = NAS2D::Utility<StructureManager>::get().getStructures<CommandCenter>();
-	auto& storageTanks = NAS2D::Utility<StructureManager>::get().getStructures<StorageTanks>();
-
-	std::vector<Structure*> storage;
-	storage.insert(storage.end(), storageTanks.begin(), storageTanks.end());
-	storage.insert(storage.end(), command.begin(), command.end());
-
-	for (auto structure : storage)
-	{
-		if (resourcesToRemove.isEmpty()) { break; }
-
-		auto& resourcesInStorage = structure->storage();
-		const auto toTransfer = resourcesToRemove.cap(resourcesInStorage);
-		resourcesInStorage -= toTransfer;
-		resourcesToRemove -= toTransfer;
-	}
+	NAS2D::Utility<StructureManager>::get().resourceLedger().remove(resourcesToRemove);
 }
@@ -32,10 +32,10 @@ struct StorableResources;
 extern const NAS2D::Point<int> CcNotPlaced;
 NAS2D::Point<int>& ccLocation();
 
-bool checkTubeConnection(Tile& tile, Direction dir, ConnectorDir sourceConnectorDir);
-bool checkStructurePlacement(Tile& tile, Direction dir);
-bool validTubeConnection(TileMap& tilemap, MapCoordinate position, ConnectorDir dir);
-bool validStructurePlacement(TileMap& tilemap, MapCoordinate position);
+bool checkTubeConnection(const Tile& tile, Direction dir, ConnectorDir sourceConnectorDir);
+bool checkStructurePlacement(const Tile& tile, Direction dir);
+bool validTubeConnection(const TileMap& tilemap, MapCoordinate position, ConnectorDir dir);
+bool validStructurePlacement(const TileMap& tilemap, MapCoordinate position);
 bool validLanderSite(Tile& t);
 bool landingSiteSuitable(TileMap& tilemap, NAS2D::Point<int> position);
 bool structureIsLander(StructureID id);
@@ -256,6 +256,7 @@ void MapViewState::load(const std::string& filePath)
 
 	mTileMap = new TileMap(mPlanetAttributes.mapImagePath, mPlanetAttributes.maxDepth);
 	mTileMap->deserialize(root);
+	resetCoverage();
 	mMapView = std::make_unique<MapView>(*mTileMap);
 	mMapView->deserialize(root);
 	mMiniMap = std::make_unique<MiniMap>(*mMapView, mTileMap, mRobotList, mPlanetAttributes.mapImagePath);
@@ -288,9 +289,9 @@ void MapViewState::load(const std::string& filePath)
 	updateResidentialCapacity();
 	updateStructuresAvailability();
 
-	updateRoads();
 	findMineRoutes();
 	updateFood();
+	NAS2D::Utility<StructureManager>::get().resourceLedger().recount(); // Storage is read after structures are added
 	updatePlayerResources();
 	updateResearch();
 
@@ -325,9 +326,6 @@ void MapViewState::load(const std::string& filePath)
 		populateStructureMenu();
 	}
 
-	updateCommRangeOverlay();
-	updatePoliceOverlay();
-
 	mMapChangedSignal();
 }
 
@@ -336,6 +334,7 @@ void MapViewState::readRobots(NAS2D::Xml::XmlElement* element)
 {
 	mRobotPool.clear();
 	mRobotList.clear();
+	mRobotAgingEvents.clear(mRobotAgingEvents.tick());
 	mRobots.clear();
 
 	for (NAS2D::Xml::XmlElement* robotElement = element->firstChildElement(); robotElement; robotElement = robotElement->nextSiblingElement())
@@ -363,6 +362,7 @@ void MapViewState::readRobots(NAS2D::Xml::XmlElement* element)
 		{
 			robot.startTask(production_time);
 			mRobotPool.insertRobotIntoTable(mRobotList, robot, mTileMap->getTile({{x, y}, depth}));
+			scheduleRobotAgingEvents(robot);
 			mRobotList[&robot]->index(TerrainType::Dozed);
 		}
 
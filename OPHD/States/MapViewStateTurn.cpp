@@ -123,7 +123,6 @@ void MapViewState::updateCommercial()
 {
 	StructureManager& structureManager = NAS2D::Utility<StructureManager>::get();
 
-	const auto& warehouses = structureManager.getStructures<Warehouse>();
 	const auto& commercial = structureManager.getStructures<Commercial>();
 
 	// No need to do anything if there are no commercial structures.
@@ -132,36 +131,14 @@ void MapViewState::updateCommercial()
 	int luxuryCount = structureManager.getCountInState(Structure::StructureClass::Commercial, StructureState::Operational);
 	int commercialCount = luxuryCount;
 
-	for (auto warehouse : warehouses)
-	{
-		ProductPool& productPool = warehouse->products();
-
-		/**
-		 * inspect for luxury products.
-		 * 
-		 * FIXME: I feel like this could be done better. At the moment there
-		 * is only one luxury item, clothing, but as this changes more
-		 * items may be seen as luxury.
-		 */
-		int clothing = productPool.count(ProductType::PRODUCT_CLOTHING);
-
-		if (clothing >= luxuryCount)
-		{
-			productPool.pull(ProductType::PRODUCT_CLOTHING, luxuryCount);
-			luxuryCount = 0;
-			break;
-		}
-		else if (clothing < luxuryCount)
-		{
-			productPool.pull(ProductType::PRODUCT_CLOTHING, clothing);
-			luxuryCount -= clothing;
-		}
-
-		if (luxuryCount == 0)
-		{
-			break;
-		}
-	}
+	/**
+	 * Pull luxury products.
+	 * 
+	 * FIXME: I feel like this could be done better. At the moment there
+	 * is only one luxury item, clothing, but as this changes more
+	 * items may be seen as luxury.
+	 */
+	luxuryCount -= structureManager.warehouseInventory().pull(ProductType::PRODUCT_CLOTHING, luxuryCount);
 
 	auto commercialReverseIterator = commercial.rbegin();
 	for (std::size_t i = 0; i < static_cast<std::size_t>(luxuryCount) && commercialReverseIterator != commercial.rend(); ++i, ++commercialReverseIterator)
@@ -270,7 +247,7 @@ void MapViewState::findMineRoutes()
 {
 	auto& smelterList = NAS2D::Utility<StructureManager>::get().getStructures<OreRefining>();
 	auto& routeTable = NAS2D::Utility<std::map<class MineFacility*, Route>>::get();
-	mTruckRouteOverlay.clear();
+	resetOverlay(mTruckRouteOverlay);
 
 	for (auto mine : NAS2D::Utility<StructureManager>::get().getStructures<MineFacility>())
 	{
@@ -296,7 +273,7 @@ void MapViewState::findMineRoutes()
 
 			for (auto tile : newRoute.path)
 			{
-				mTruckRouteOverlay.push_back(static_cast<Tile*>(tile));
+				mTruckRouteOverlay.set(static_cast<Tile*>(tile)->xyz());
 			}
 		}
 	}
@@ -400,18 +377,11 @@ void MapViewState::checkColonyShip()
 
 void MapViewState::checkWarehouseCapacity()
 {
-	StructureManager& structureManager = NAS2D::Utility<StructureManager>::get();
-	const auto& warehouses = structureManager.getStructures<Warehouse>();
-
-	if (warehouses.size() == 0) { return; } // no divisions by zero, pl0x
+	const auto& warehouseInventory = NAS2D::Utility<StructureManager>::get().warehouseInventory();
 
-	int availableStorageTotal = 0;
-	for (const auto warehouse : warehouses)
-	{
-		availableStorageTotal += warehouse->products().availableStoragePercent();
-	}
+	if (warehouseInventory.empty()) { return; }
 
-	const int availableStorage = availableStorageTotal / static_cast<int>(warehouses.size());
+	const int availableStorage = warehouseInventory.meanAvailableStoragePercent();
 
 	if (availableStorage == 0) // FIXME -- Magic Number
 	{
@@ -533,41 +503,6 @@ void MapViewState::transferFoodToCommandCenter()
 }
 
 
-/**
- * Update road intersection patterns
- */
-void MapViewState::updateRoads()
-{
-	auto roads = NAS2D::Utility<StructureManager>::get().getStructures<Road>();
-
-	for (auto road : roads)
-	{
-		if (!road->operational()) { continue; }
-
-		const auto tileLocation = NAS2D::Utility<StructureManager>::get().tileFromStructure(road).xy();
-
-		std::array<bool, 4> surroundingTiles{false, false, false, false};
-		for (size_t i = 0; i < 4; ++i)
-		{
-			const auto tileToInspect = tileLocation + DirectionClockwise4[i];
-			const auto surfacePosition = MapCoordinate{tileToInspect, 0};
-			if (!mTileMap->isValidPosition(surfacePosition)) { continue; }
-			const auto& tile = mTileMap->getTile(surfacePosition);
-			if (!tile.thingIsStructure()) { continue; }
-
-			surroundingTiles[i] = tile.structure()->structureId() == StructureID::SID_ROAD;
-		}
-
-		std::string tag = "";
-		
-		if (road->integrity() < constants::RoadIntegrityChange) { tag = "-decayed"; }
-		else if (road->integrity() == 0) { tag = "-destroyed"; }
-
-		road->sprite().play(IntersectionPatternTable.at(surroundingTiles) + tag);
-	}
-}
-
-
 void MapViewState::checkAgingStructures()
 {
 	const auto& structures = NAS2D::Utility<StructureManager>::get().agingStructures();
@@ -615,28 +550,28 @@ void MapViewState::checkNewlyBuiltStructures()
 
 void MapViewState::updateMaintenance()
 {
-	auto sortLambda = [](const Structure* lhs, const Structure* rhs) -> bool
-	{
-		return lhs->integrity() < rhs->integrity();
-	};
-
 	auto& structureManager = NAS2D::Utility<StructureManager>::get();
-	auto structures = structureManager.allStructures();
-	std::sort(structures.begin(), structures.end(), sortLambda);
+	auto& maintenanceQueue = structureManager.maintenanceQueue();
 
 	auto& maintenanceFacilities = structureManager.getStructures<MaintenanceFacility>();
 	for (auto maintenanceFacility : maintenanceFacilities)
 	{
-		maintenanceFacility->repairStructures(structures);
+		maintenanceFacility->repairStructures(maintenanceQueue);
 	}
+
+	// Rebuilt structures start construction over and repaired roads may no longer look decayed
+	for (auto* structure : maintenanceQueue.taken())
+	{
+		if (structure->underConstruction()) { structureManager.scheduleConstruction(*structure); }
+		else if (structure->isRoad()) { static_cast<Road*>(structure)->updateAnimation(); }
+	}
+
+	maintenanceQueue.restoreTaken();
 }
 
 
 void MapViewState::updateOverlays()
 {
-	updateCommRangeOverlay();
-	updatePoliceOverlay();
-
 	if (mBtnToggleConnectedness.isPressed()) { onToggleConnectedness(); }
 	if (mBtnToggleCommRangeOverlay.isPressed()) { onToggleCommRangeOverlay(); }
 	if (mBtnToggleRouteOverlay.isPressed()) { onToggleRouteOverlay(); }
@@ -712,7 +647,7 @@ void MapViewState::nextTurn()
 
 	if (mPopulation.getPopulations().size() > 0)
 	{
-		mCrimeRateUpdate.update(mPoliceOverlays);
+		mCrimeRateUpdate.update(mPoliceCoverage.overlay());
 		auto structuresCommittingCrimes = mCrimeRateUpdate.structuresCommittingCrimes();
 		mCrimeExecution.executeCrimes(structuresCommittingCrimes);
 	}
@@ -727,7 +662,6 @@ void MapViewState::nextTurn()
 	updateRobots();
 	updateResources();
 	updateStructuresAvailability();
-	updateRoads();
 
 	updateOverlays();
 
@@ -746,6 +680,8 @@ void MapViewState::nextTurn()
 	checkWarehouseCapacity();
 
 	mMineOperationsWindow.updateTruckAvailability();
+	mMiniMap->invalidateLayer();
+	mStructureInspector.invalidateTables();
 
 	// Check for Game Over conditions
 	if (mPopulation.getPopulations().size() <= 0 && mLandersColonist == 0)
@@ -375,7 +375,7 @@ void MapViewState::drawUI()
 	renderer.drawBox(mBottomUiRect, NAS2D::Color{21, 21, 21});
 	renderer.drawLine(NAS2D::Point{mBottomUiRect.position.x + 1, mBottomUiRect.position.y}, NAS2D::Point{mBottomUiRect.position.x + mBottomUiRect.size.x - 2, mBottomUiRect.position.y}, NAS2D::Color{56, 56, 56});
 
-	mMiniMap->draw();
+	mMiniMap->update();
 	mNavControl->draw();
 	mRobotDeploymentSummary.draw();
 
@@ -403,40 +403,24 @@ void MapViewState::drawUI()
 	// Windows
 	mFileIoDialog.update();
 	mGameOptionsDialog.update();
-	mWindowStack.update();
-
-	if (!modalUiElementDisplayed()) { mToolTip.update(); }
-}
-
-
-void MapViewState::setOverlay(std::vector<Tile*>& tileList, Tile::Overlay overlay)
-{
-	for (auto tile : tileList)
 	{
-		tile->overlay(overlay);
+		FrameProfiler::Scope scope{mFrameProfiler, FrameProfiler::Phase::WindowStack};
+		mWindowStack.update();
 	}
-}
-
 
-void MapViewState::clearOverlays()
-{
-	clearOverlay(mConnectednessOverlay);
-	clearOverlay(mCommRangeOverlay);
-	clearOverlay(mPoliceOverlays[static_cast<std::size_t>(mMapView->currentDepth())]);
-	clearOverlay(mTruckRouteOverlay);
+	if (!modalUiElementDisplayed()) { mToolTip.update(); }
 }
 
 
-void MapViewState::clearOverlay(std::vector<Tile*>& tileList)
+void MapViewState::setOverlay(const OverlayLayer& overlay, Tile::Overlay overlayType)
 {
-	setOverlay(tileList, Tile::Overlay::None);
+	mDetailMap->overlay(&overlay, overlayType);
 }
 
 
-void MapViewState::changePoliceOverlayDepth(int oldDepth, int newDepth)
+void MapViewState::clearOverlays()
 {
-	clearOverlay(mPoliceOverlays[static_cast<std::size_t>(oldDepth)]);
-	setOverlay(mPoliceOverlays[static_cast<std::size_t>(newDepth)], Tile::Overlay::Police);
+	mDetailMap->overlay(nullptr, Tile::Overlay::None);
 }
 
 
@@ -474,7 +458,7 @@ void MapViewState::onToggleCommRangeOverlay()
 		mBtnToggleRouteOverlay.toggle(false);
 		mBtnTogglePoliceOverlay.toggle(false);
 
-		setOverlay(mCommRangeOverlay, Tile::Overlay::Communications);
+		setOverlay(mCommRangeCoverage.overlay(), Tile::Overlay::Communications);
 	}
 }
 
@@ -488,7 +472,7 @@ void MapViewState::onTogglePoliceOverlay()
 		mBtnToggleConnectedness.toggle(false);
 		mBtnToggleRouteOverlay.toggle(false);
 
-		setOverlay(mPoliceOverlays[static_cast<std::size_t>(mMapView->currentDepth())], Tile::Overlay::Police);
+		setOverlay(mPoliceCoverage.overlay(), Tile::Overlay::Police);
 	}
 }
 
@@ -587,6 +571,7 @@ void MapViewState::onDiggerSelectionDialog(Direction direction, Tile& tile)
 	Robodigger& robot = mRobotPool.getDigger();
 	robot.startTask(tile);
 	mRobotPool.insertRobotIntoTable(mRobotList, robot, tile);
+	scheduleRobotAgingEvents(robot);
 
 	robot.direction(direction);
 
@@ -1,6 +1,7 @@
 #include "StructureManager.h"
 
 #include "Constants/Numbers.h"
+#include "DirectionOffset.h"
 #include "ProductPool.h"
 #include "IOHelper.h"
 #include "PopulationPool.h"
@@ -8,8 +9,6 @@
 #include "MapObjects/Robot.h"
 #include "GraphWalker.h"
 
-#include "States/MapViewStateHelper.h" // <-- For removeRefinedResources()
-
 #include <NAS2D/ParserHelper.h>
 #include <NAS2D/StringUtils.h>
 #include <NAS2D/ContainerUtils.h>
@@ -159,7 +158,33 @@ void StructureManager::addStructure(Structure& structure, Tile& tile)
 	mStructureTileTable[&structure] = &tile;
 
 	mStructureLists[structure.structureClass()].push_back(&structure);
+	mSpatialIndex.insert(structure, tile.xyz());
+	mMaintenanceQueue.insert(structure);
+	mResourceLedger.insert(structure);
+	if (structure.isWarehouse()) { mWarehouseInventory.insert(static_cast<Warehouse&>(structure)); }
 	tile.pushMapObject(&structure);
+
+	if (structure.isRoad()) { updateRoadNeighbourhood(tile.xyz()); }
+
+	scheduleConstruction(structure);
+	if (structure.ages())
+	{
+		scheduleAgeEvent({AgeEvent::Type::AgingWarning, &structure, structure.maxAge() - 10});
+		scheduleAgeEvent({AgeEvent::Type::AgingWarning, &structure, structure.maxAge() - 5});
+	}
+
+	structure.stateChanged().connect({this, &StructureManager::onStructureStateChanged});
+	mStructureAdded(structure);
+}
+
+
+/**
+ * Schedules the construction finished event for a structure that is
+ * being built or rebuilt.
+ */
+void StructureManager::scheduleConstruction(Structure& structure)
+{
+	scheduleAgeEvent({AgeEvent::Type::ConstructionComplete, &structure, structure.turnsToBuild()});
 }
 
 
@@ -184,8 +209,20 @@ void StructureManager::removeStructure(Structure& structure)
 	const auto isFoundTileTable = tileTableIt != mStructureTileTable.end();
 	if (isFoundTileTable)
 	{
+		mStructureRemoved(structure);
+
+		mSpatialIndex.remove(structure, tileTableIt->second->xyz());
+		mMaintenanceQueue.remove(structure);
+		mResourceLedger.remove(structure);
+		if (structure.isWarehouse()) { mWarehouseInventory.remove(static_cast<Warehouse&>(structure)); }
+		mAgeEvents.cancelIf([&structure](const AgeEvent& event) { return event.structure == &structure; });
+
+		const auto position = tileTableIt->second->xyz();
+		const auto isRoad = structure.isRoad();
 		tileTableIt->second->deleteMapObject();
 		mStructureTileTable.erase(tileTableIt);
+
+		if (isRoad) { updateRoadNeighbourhood(position); }
 	}
 
 	if (!isFoundStructureTable || !isFoundTileTable)
@@ -217,12 +254,10 @@ StructureList StructureManager::allStructures() const
 
 Tile& StructureManager::tileFromStructure(const Structure* structure) const
 {
-	for (const auto& [keyStructure, valueTile] : mStructureTileTable)
+	const auto it = mStructureTileTable.find(const_cast<Structure*>(structure));
+	if (it != mStructureTileTable.end())
 	{
-		if (keyStructure == structure)
-		{
-			return *valueTile;
-		}
+		return *it->second;
 	}
 	throw std::runtime_error("Could not find tile for structure");
 }
@@ -253,11 +288,14 @@ std::vector<Tile*> StructureManager::getConnectednessOverlay() const
 {
 	std::vector<Tile*> result;
 	result.reserve(mStructureTileTable.size());
-	for (const auto& [structure, tile] : mStructureTileTable)
+	for (const auto& [structureClass, structures] : mStructureLists)
 	{
-		if (structure->connected())
+		for (auto* structure : structures)
 		{
-			result.push_back(tile);
+			if (structure->connected())
+			{
+				result.push_back(mStructureTileTable.at(structure));
+			}
 		}
 	}
 	return result;
@@ -269,22 +307,33 @@ std::vector<Tile*> StructureManager::getConnectednessOverlay() const
  */
 void StructureManager::disconnectAll()
 {
-	for (auto& pair : mStructureTileTable)
+	for (auto& [structureClass, structures] : mStructureLists)
 	{
-		pair.first->connected(false);
+		for (auto* structure : structures)
+		{
+			structure->connected(false);
+		}
 	}
 }
 
 
 void StructureManager::dropAllStructures()
 {
-	for (auto& pair : mStructureTileTable)
+	for (auto& [structureClass, structures] : mStructureLists)
 	{
-		pair.second->deleteMapObject();
+		for (auto* structure : structures)
+		{
+			mStructureTileTable.at(structure)->deleteMapObject();
+		}
 	}
 
 	mStructureTileTable.clear();
 	mStructureLists = populateKeys();
+	mSpatialIndex.clear();
+	mMaintenanceQueue.clear();
+	mResourceLedger.clear();
+	mWarehouseInventory.clear();
+	mAgeEvents.clear(mAgeEvents.tick());
 }
 
 
@@ -472,6 +521,8 @@ void StructureManager::update(const StorableResources& resources, PopulationPool
 
 	updateStructures(resources, population, mStructureLists[Structure::StructureClass::Undefined]);
 
+	mAgeEvents.advance([this](const AgeEvent& event) { dispatchAgeEvent(event); });
+
 	assignColonistsToResidences(population);
 	
 	/**
@@ -480,6 +531,15 @@ void StructureManager::update(const StorableResources& resources, PopulationPool
 	 * they can either manually set a structure to idle or bulldoze it.
 	 */
 	assignScientistsToResearchFacilities(population);
+
+	// Integrity and state of structures are settled for this turn
+	for (auto& [structureClass, structures] : mStructureLists)
+	{
+		for (auto* structure : structures)
+		{
+			mMaintenanceQueue.update(*structure);
+		}
+	}
 }
 
 
@@ -487,15 +547,105 @@ NAS2D::Xml::XmlElement* StructureManager::serialize() const
 {
 	auto* structures = new NAS2D::Xml::XmlElement("structures");
 
-	for (auto& [structure, tile] : mStructureTileTable)
+	// Written in structure list order so the order of each list survives a save and load
+	for (auto& [structureClass, structureList] : mStructureLists)
 	{
-		structures->linkEndChild(serializeStructure(*structure, *tile));
+		for (auto* structure : structureList)
+		{
+			structures->linkEndChild(serializeStructure(*structure, *mStructureTileTable.at(structure)));
+		}
 	}
 
 	return structures;
 }
 
 
+Road* StructureManager::roadAt(const MapCoordinate& position) const
+{
+	return findStructureInRange<Road>(position, 0, [](const Road&) { return true; });
+}
+
+
+/**
+ * Sets the neighbour mask of the road at \c position, if there is one.
+ */
+void StructureManager::updateRoadNeighbourMask(const MapCoordinate& position)
+{
+	auto* road = roadAt(position);
+	if (!road) { return; }
+
+	std::size_t mask = 0;
+	for (std::size_t i = 0; i < DirectionClockwise4.size(); ++i)
+	{
+		if (roadAt({position.xy + DirectionClockwise4[i], position.z})) { mask |= std::size_t{1} << i; }
+	}
+	road->neighbourMask(mask);
+}
+
+
+/**
+ * Updates the neighbour masks of the roads at and around \c position after
+ * a road was added or removed there.
+ */
+void StructureManager::updateRoadNeighbourhood(const MapCoordinate& position)
+{
+	updateRoadNeighbourMask(position);
+	for (const auto& direction : DirectionClockwise4)
+	{
+		updateRoadNeighbourMask({position.xy + direction, position.z});
+	}
+}
+
+
+/**
+ * Schedules an age event for the update in which the structure reaches
+ * the event's age. Events for ages already reached are ignored.
+ */
+void StructureManager::scheduleAgeEvent(AgeEvent event)
+{
+	const auto turnsRemaining = event.age - event.structure->age();
+	if (turnsRemaining <= 0) { return; }
+
+	mAgeEvents.schedule(mAgeEvents.tick() + static_cast<std::uint64_t>(turnsRemaining), event);
+}
+
+
+/**
+ * Handles an age event that has come due.
+ *
+ * \note	A structure's age can be reset (e.g., roads being rebuilt) so
+ *			events that arrive early are put back on the wheel.
+ */
+void StructureManager::dispatchAgeEvent(const AgeEvent& event)
+{
+	auto& structure = *event.structure;
+	if (structure.destroyed()) { return; }
+
+	if (structure.age() < event.age)
+	{
+		scheduleAgeEvent(event);
+		return;
+	}
+
+	if (structure.age() > event.age) { return; }
+
+	if (event.type == AgeEvent::Type::ConstructionComplete)
+	{
+		mNewlyBuiltStructures.push_back(&structure);
+	}
+	else
+	{
+		mAgingStructures.push_back(&structure);
+	}
+}
+
+
+void StructureManager::onStructureStateChanged(Structure& structure)
+{
+	mStructureStateChanged(structure);
+}
+
+
 void StructureManager::updateStructures(const StorableResources& resources, PopulationPool& population, StructureList& structures)
 {
 	Structure* structure = nullptr;
@@ -504,16 +654,6 @@ void StructureManager::updateStructures(const StorableResources& resources, Popu
 		structure = structures[i];
 		structure->update();
 
-		if (structure->ages() && (structure->age() >= structure->maxAge() - 10))
-		{
-			mAgingStructures.push_back(structure);
-		}
-
-		if (structure->age() == structure->turnsToBuild())
-		{
-			mNewlyBuiltStructures.push_back(structure);
-		}
-
 		if (structure->hasCrime() && !structure->underConstruction())
 		{
 			mStructuresWithCrime.push_back(structure);
@@ -579,7 +719,7 @@ void StructureManager::updateStructures(const StorableResources& resources, Popu
 			population.usePopulation(populationRequired);
 
 			auto consumed = structure->resourcesIn();
-			removeRefinedResources(consumed);
+			mResourceLedger.remove(consumed);
 
 			mTotalEnergyUsed += structure->energyRequirement();
 
@@ -1,9 +1,16 @@
 #pragma once
 
+#include "MaintenanceQueue.h"
+#include "ResourceLedger.h"
+#include "StructureSpatialIndex.h"
+#include "WarehouseInventory.h"
 #include "MapObjects/Structure.h"
 #include "MapObjects/Structures.h"
 
+#include <libOPHD/TimerWheel.h>
+
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 
@@ -104,6 +111,20 @@ public:
 		return output;
 	}
 
+	/**
+	 * Finds a structure of a given type within \c radius tiles of \c center.
+	 *
+	 * \param	predicate	Called with each candidate, returns true to accept it.
+	 */
+	template <typename StructureType, typename Predicate>
+	StructureType* findStructureInRange(const MapCoordinate& center, int radius, Predicate predicate) const
+	{
+		return static_cast<StructureType*>(mSpatialIndex.findInRange(structureTypeToClass<StructureType>(), center, radius, [&predicate](Structure& structure) {
+			auto* derivedStructure = dynamic_cast<StructureType*>(&structure);
+			return derivedStructure && predicate(*derivedStructure);
+		}));
+	}
+
 	const StructureList& structureList(Structure::StructureClass structureClass) const;
 	StructureList allStructures() const;
 
@@ -140,18 +161,64 @@ public:
 
 	void update(const StorableResources&, PopulationPool&);
 
+	void scheduleConstruction(Structure& structure);
+
+	MaintenanceQueue& maintenanceQueue() { return mMaintenanceQueue; }
+	ResourceLedger& resourceLedger() { return mResourceLedger; }
+	WarehouseInventory& warehouseInventory() { return mWarehouseInventory; }
+
+	/**
+	 * Signals for structures being added, removed or changing state.
+	 *
+	 * \note	dropAllStructures() does not signal removals.
+	 */
+	using StructureSignal = NAS2D::Signal<Structure&>;
+	StructureSignal::Source& structureAdded() { return mStructureAdded; }
+	StructureSignal::Source& structureRemoved() { return mStructureRemoved; }
+	StructureSignal::Source& structureStateChanged() { return mStructureStateChanged; }
+
 	NAS2D::Xml::XmlElement* serialize() const;
 
 private:
-	using StructureTileTable = std::map<Structure*, Tile*>;
+	using StructureTileTable = std::unordered_map<Structure*, Tile*>;
 	using StructureClassTable = std::map<Structure::StructureClass, StructureList>;
 
+	/**
+	 * Something that happens to a structure once it reaches a given age.
+	 */
+	struct AgeEvent
+	{
+		enum class Type
+		{
+			ConstructionComplete,
+			AgingWarning
+		};
+
+		Type type;
+		Structure* structure;
+		int age;
+	};
+
 	void disconnectAll();
 
 	void updateStructures(const StorableResources&, PopulationPool&, StructureList&);
 
-	StructureTileTable mStructureTileTable; /**< List mapping Structures to a particular tile. */
+	Road* roadAt(const MapCoordinate& position) const;
+	void updateRoadNeighbourMask(const MapCoordinate& position);
+	void updateRoadNeighbourhood(const MapCoordinate& position);
+
+	void scheduleAgeEvent(AgeEvent event);
+	void dispatchAgeEvent(const AgeEvent& event);
+
+	void onStructureStateChanged(Structure& structure);
+
+	StructureTileTable mStructureTileTable; /**< List mapping Structures to a particular tile. Unordered, so iterate mStructureLists instead. */
 	StructureClassTable mStructureLists; /**< Map containing all of the structure list types available. */
+	StructureSpatialIndex mSpatialIndex; /**< Structures bucketed by position for range queries. */
+	MaintenanceQueue mMaintenanceQueue; /**< Structures ordered by how urgently they need repair. */
+	ResourceLedger mResourceLedger; /**< Refined resource storage structures and their total. */
+	WarehouseInventory mWarehouseInventory; /**< Products held across all warehouses. */
+	TimerWheel<AgeEvent> mAgeEvents; /**< Age events keyed by update count. */
 
 	StructureList mAgingStructures;
 	StructureList mNewlyBuiltStructures;
@@ -159,4 +226,8 @@ private:
 
 	int mTotalEnergyOutput = 0; /**< Total energy output of all energy producers in the structure list. */
 	int mTotalEnergyUsed = 0;
+
+	StructureSignal mStructureAdded;
+	StructureSignal mStructureRemoved;
+	StructureSignal mStructureStateChanged;
 };
@@ -0,0 +1,63 @@
+#include "StructureSpatialIndex.h"
+
+#include <stdexcept>
+
+
+namespace
+{
+	int floorDivide(int value, int divisor)
+	{
+		return (value >= 0) ? value / divisor : (value - divisor + 1) / divisor;
+	}
+}
+
+
+void StructureSpatialIndex::insert(Structure& structure, const MapCoordinate& position)
+{
+	const auto bucket = bucketPosition(position.xy);
+	mBuckets[{structure.structureClass(), position.z, bucket.x, bucket.y}].push_back({&structure, position.xy});
+}
+
+
+void StructureSpatialIndex::remove(Structure& structure, const MapCoordinate& position)
+{
+	const auto bucket = bucketPosition(position.xy);
+	const auto it = mBuckets.find({structure.structureClass(), position.z, bucket.x, bucket.y});
+	if (it != mBuckets.end())
+	{
+		auto& entries = it->second;
+		const auto entryIt = std::find_if(entries.begin(), entries.end(), [&structure](const Entry& entry) { return entry.structure == &structure; });
+		if (entryIt != entries.end())
+		{
+			entries.erase(entryIt);
+			if (entries.empty()) { mBuckets.erase(it); }
+			return;
+		}
+	}
+
+	throw std::runtime_error("StructureSpatialIndex::remove(): Structure is not in the index at the given position");
+}
+
+
+void StructureSpatialIndex::clear()
+{
+	mBuckets.clear();
+}
+
+
+NAS2D::Point<int> StructureSpatialIndex::bucketPosition(NAS2D::Point<int> position)
+{
+	return {floorDivide(position.x, BucketSize), floorDivide(position.y, BucketSize)};
+}
+
+
+/**
+ * First and last bucket positions, inclusive, covering a square of
+ * \c radius tiles around \c center.
+ */
+std::pair<NAS2D::Point<int>, NAS2D::Point<int>> StructureSpatialIndex::bucketRange(NAS2D::Point<int> center, int radius)
+{
+	const auto offset = NAS2D::Vector{radius, radius};
+	return {bucketPosition(center - offset), bucketPosition(center + offset)};
+}
+
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "MapObjects/Structure.h"
+#include "Map/MapCoordinate.h"
+
+#include <NAS2D/Math/Point.h>
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+/**
+ * Grid bucket index of structures by class and position.
+ *
+ * The map is divided into square buckets. Range queries only visit
+ * the buckets that overlap the search area so their cost depends on
+ * the number of nearby structures rather than the size of the colony.
+ */
+class StructureSpatialIndex
+{
+public:
+	struct Entry
+	{
+		Structure* structure;
+		NAS2D::Point<int> position;
+	};
+
+	void insert(Structure& structure, const MapCoordinate& position);
+	void remove(Structure& structure, const MapCoordinate& position);
+	void clear();
+
+	/**
+	 * Finds a structure within \c radius tiles of \c center that satisfies \c predicate.
+	 *
+	 * \return	The first structure found or \c nullptr if there is none.
+	 */
+	template <typename Predicate>
+	Structure* findInRange(Structure::StructureClass structureClass, const MapCoordinate& center, int radius, Predicate predicate) const
+	{
+		const auto [firstBucket, lastBucket] = bucketRange(center.xy, radius);
+		for (int y = firstBucket.y; y <= lastBucket.y; ++y)
+		{
+			for (int x = firstBucket.x; x <= lastBucket.x; ++x)
+			{
+				const auto it = mBuckets.find({structureClass, center.z, x, y});
+				if (it == mBuckets.end()) { continue; }
+
+				for (const auto& entry : it->second)
+				{
+					if ((entry.position - center.xy).lengthSquared() <= radius * radius && predicate(*entry.structure))
+					{
+						return entry.structure;
+					}
+				}
+			}
+		}
+		return nullptr;
+	}
+
+private:
+	static constexpr int BucketSize = 16;
+
+	using BucketKey = std::tuple<Structure::StructureClass, int, int, int>; /**< {class, depth, bucket x, bucket y} */
+	using BucketTable = std::map<BucketKey, std::vector<Entry>>;
+
+	static NAS2D::Point<int> bucketPosition(NAS2D::Point<int> position);
+	static std::pair<NAS2D::Point<int>, NAS2D::Point<int>> bucketRange(NAS2D::Point<int> center, int radius);
+
+	BucketTable mBuckets;
+};
@@ -4,14 +4,14 @@
 #include "../Map/Tile.h"
 #include "../Map/TileMap.h"
 #include "../Map/MapView.h"
+#include "../Map/OverlayLayer.h"
 #include "../MapObjects/MapObject.h"
 
 #include <NAS2D/Renderer/Color.h>
 #include <NAS2D/Renderer/Renderer.h>
 #include <NAS2D/Utility.h>
-#include <NAS2D/Math/PointInRectangleRange.h>
 
-#include <map>
+#include <array>
 #include <cmath>
 
 
@@ -23,22 +23,23 @@ namespace {
 	const auto TileDrawSize = NAS2D::Vector{128, 64};
 	const auto TileDrawOffset = NAS2D::Vector{TileDrawSize.x / 2, TileDrawSize.y - TileSize.y};
 
-	const std::map<Tile::Overlay, NAS2D::Color> OverlayColors =
+	// Indexed by Tile::Overlay
+	const std::array<NAS2D::Color, 5> OverlayColors =
 	{
-		{Tile::Overlay::None, NAS2D::Color::Normal},
-		{Tile::Overlay::Communications, {125, 200, 255}},
-		{Tile::Overlay::Connectedness, NAS2D::Color::Green},
-		{Tile::Overlay::TruckingRoutes, NAS2D::Color::Orange},
-		{Tile::Overlay::Police, NAS2D::Color::Red}
+		NAS2D::Color{125, 200, 255}, // Communications
+		NAS2D::Color::Green, // Connectedness
+		NAS2D::Color::Orange, // TruckingRoutes
+		NAS2D::Color::Red, // Police
+		NAS2D::Color::Normal // None
 	};
 
-	const std::map<Tile::Overlay, NAS2D::Color> OverlayHighlightColors =
+	const std::array<NAS2D::Color, 5> OverlayHighlightColors =
 	{
-		{Tile::Overlay::None, NAS2D::Color{125, 200, 255}},
-		{Tile::Overlay::Communications, {100, 180, 230}},
-		{Tile::Overlay::Connectedness, NAS2D::Color{71, 224, 146}},
-		{Tile::Overlay::TruckingRoutes, NAS2D::Color{125, 200, 255}},
-		{Tile::Overlay::Police, NAS2D::Color{100, 180, 230}}
+		NAS2D::Color{100, 180, 230}, // Communications
+		NAS2D::Color{71, 224, 146}, // Connectedness
+		NAS2D::Color{125, 200, 255}, // TruckingRoutes
+		NAS2D::Color{100, 180, 230}, // Police
+		NAS2D::Color{125, 200, 255} // None
 	};
 
 	const double ThrobSpeed = 250.0; // Throb speed of mine beacon
@@ -47,7 +48,7 @@ namespace {
 
 	const NAS2D::Color& overlayColor(Tile::Overlay overlay, bool isHighlighted)
 	{
-		return (isHighlighted ? OverlayHighlightColors : OverlayColors).at(overlay);
+		return (isHighlighted ? OverlayHighlightColors : OverlayColors)[static_cast<std::size_t>(overlay)];
 	}
 }
 
@@ -73,6 +74,20 @@ void DetailMap::resize(NAS2D::Vector<int> size)
 }
 
 
+/**
+ * Sets the overlay drawn over the map.
+ *
+ * \param	overlay		Overlay to draw or \c nullptr to draw none. The overlay
+ *						must remain valid until it is replaced.
+ * \param	overlayType	Type of overlay, determines the color of covered tiles.
+ */
+void DetailMap::overlay(const OverlayLayer* overlay, Tile::Overlay overlayType)
+{
+	mOverlay = overlay;
+	mOverlayType = overlay ? overlayType : Tile::Overlay::None;
+}
+
+
 /**
  * Returns true if the current tile highlight is actually within the visible diamond map.
  */
@@ -100,14 +115,19 @@ Tile& DetailMap::mouseTile()
 
 void DetailMap::update()
 {
-	for (const auto tilePosition : PointInRectangleRange{mMapView.viewTileRect()})
+	if (!mTerrainBatchValid || mTerrainBatchKey != terrainBatchKey())
 	{
-		auto& tile = mTileMap.getTile({tilePosition, mMapView.currentDepth()});
+		rebuildTerrainBatch();
+	}
 
-		if (tile.thing())
-		{
-			tile.thing()->sprite().update();
-		}
+	if (!mVisibleObjectsValid || mVisibleObjectsKey != visibleObjectsKey())
+	{
+		rebuildVisibleObjects();
+	}
+
+	for (const auto& visibleObject : mVisibleObjects)
+	{
+		if (visibleObject.mapObject) { visibleObject.mapObject->sprite().update(); }
 	}
 }
 
@@ -116,39 +136,119 @@ void DetailMap::draw() const
 {
 	auto& renderer = Utility<Renderer>::get();
 
-	int tsetOffset = mMapView.currentDepth() > 0 ? TileDrawSize.y : 0;
-
-	for (const auto tilePosition : PointInRectangleRange{mMapView.viewTileRect()})
+	for (const auto& quad : mTerrainBatch)
 	{
-		auto& tile = mTileMap.getTile({tilePosition, mMapView.currentDepth()});
+		const bool isTileHighlighted = quad.tilePosition == mMouseTilePosition;
+		renderer.drawSubImage(mTileset, quad.drawPosition, quad.subImageRect, overlayColor(quad.overlay, isTileHighlighted));
+	}
 
-		if (tile.excavated())
+	// Mine beacons and map objects change from frame to frame so are drawn over the terrain
+	const uint8_t glow = static_cast<uint8_t>(120 + std::sin(throbTimer.tick() / ThrobSpeed) * 57);
+	for (const auto& visibleObject : mVisibleObjects)
+	{
+		if (visibleObject.mapObject)
 		{
-			const auto offset = tilePosition - mMapView.viewTileRect().position;
-			const auto position = mOriginPixelPosition - TileDrawOffset + NAS2D::Vector{(offset.x - offset.y) * TileSize.x / 2, (offset.x + offset.y) * TileSize.y / 2};
-			const auto subImageRect = NAS2D::Rectangle{{static_cast<int>(tile.index()) * TileDrawSize.x, tsetOffset}, TileDrawSize};
-			const bool isTileHighlighted = tilePosition == mMouseTilePosition;
-
-			renderer.drawSubImage(mTileset, position, subImageRect, overlayColor(tile.overlay(), isTileHighlighted));
-
-			// Draw a beacon on an unoccupied tile with a mine
-			if (tile.mine() != nullptr && !tile.thing())
-			{
-				uint8_t glow = static_cast<uint8_t>(120 + std::sin(throbTimer.tick() / ThrobSpeed) * 57);
-				renderer.drawImage(mMineBeacon, position + NAS2D::Vector{0, -64});
-				renderer.drawSubImage(mMineBeacon, position + NAS2D::Vector{59, 15}, NAS2D::Rectangle<int>{{59, 79}, {10, 7}}, NAS2D::Color{glow, glow, glow});
-			}
-
-			// Tell an occupying thing to update itself.
-			if (tile.thing())
-			{
-				tile.thing()->sprite().draw(position);
-			}
+			visibleObject.mapObject->sprite().draw(visibleObject.drawPosition);
+		}
+		else
+		{
+			renderer.drawImage(mMineBeacon, visibleObject.drawPosition + NAS2D::Vector{0, -64});
+			renderer.drawSubImage(mMineBeacon, visibleObject.drawPosition + NAS2D::Vector{59, 15}, NAS2D::Rectangle<int>{{59, 79}, {10, 7}}, NAS2D::Color{glow, glow, glow});
 		}
 	}
 }
 
 
+DetailMap::TerrainBatchKey DetailMap::terrainBatchKey() const
+{
+	return {
+		mMapView.viewTileRect(),
+		mMapView.currentDepth(),
+		mOriginPixelPosition,
+		mTileMap.terrainRevision(mMapView.currentDepth()),
+		mOverlay,
+		mOverlayType,
+		mOverlay ? mOverlay->revision() : 0
+	};
+}
+
+
+/**
+ * Rebuilds the terrain quads for the current view.
+ *
+ * Only needed when the view, depth, terrain or overlay changes. Tiles are
+ * visited row by row, which draws the isometric diamond back to front.
+ */
+void DetailMap::rebuildTerrainBatch()
+{
+	mTerrainBatchKey = terrainBatchKey();
+	mTerrainBatchValid = true;
+	mTerrainBatch.clear();
+
+	const int tsetOffset = mMapView.currentDepth() > 0 ? TileDrawSize.y : 0;
+
+	// Tiles in unallocated chunks are never excavated
+	mTileMap.forEachAllocatedTile(mMapView.viewTileRect(), mMapView.currentDepth(), [&](const Tile& tile) {
+		if (!tile.excavated()) { return; }
+
+		const auto overlayType = (mOverlay && mOverlay->contains(tile.xyz())) ? mOverlayType : Tile::Overlay::None;
+		mTerrainBatch.push_back({
+			tile.xy(),
+			tileDrawPosition(tile.xy()),
+			NAS2D::Rectangle{{static_cast<int>(tile.index()) * TileDrawSize.x, tsetOffset}, TileDrawSize},
+			overlayType
+		});
+	});
+}
+
+
+DetailMap::VisibleObjectsKey DetailMap::visibleObjectsKey() const
+{
+	return {
+		mMapView.viewTileRect(),
+		mMapView.currentDepth(),
+		mOriginPixelPosition,
+		mTileMap.terrainRevision(mMapView.currentDepth()),
+		Tile::objectRevision()
+	};
+}
+
+
+/**
+ * Rebuilds the list of map objects and mine beacons in view.
+ *
+ * Only needed when the view changes or objects are added to or removed
+ * from tiles, so each frame only visits occupied tiles instead of every
+ * tile in view.
+ */
+void DetailMap::rebuildVisibleObjects()
+{
+	mVisibleObjectsKey = visibleObjectsKey();
+	mVisibleObjectsValid = true;
+	mVisibleObjects.clear();
+
+	mTileMap.forEachAllocatedTile(mMapView.viewTileRect(), mMapView.currentDepth(), [&](const Tile& tile) {
+		if (!tile.excavated()) { return; }
+
+		if (tile.thing())
+		{
+			mVisibleObjects.push_back({tileDrawPosition(tile.xy()), tile.thing()});
+		}
+		else if (tile.mine() != nullptr)
+		{
+			mVisibleObjects.push_back({tileDrawPosition(tile.xy()), nullptr});
+		}
+	});
+}
+
+
+NAS2D::Point<int> DetailMap::tileDrawPosition(NAS2D::Point<int> tilePosition) const
+{
+	const auto offset = tilePosition - mMapView.viewTileRect().position;
+	return mOriginPixelPosition - TileDrawOffset + NAS2D::Vector{(offset.x - offset.y) * TileSize.x / 2, (offset.x + offset.y) * TileSize.y / 2};
+}
+
+
 void DetailMap::drawGrid() const
 {
 	auto& renderer = Utility<Renderer>::get();
@@ -3,13 +3,18 @@
 #include <libControls/Control.h>
 
 #include "../Map/MapCoordinate.h"
+#include "../Map/Tile.h"
 
 #include <NAS2D/Resource/Image.h>
 
+#include <cstdint>
+#include <vector>
+
 
-class Tile;
 class TileMap;
 class MapView;
+class OverlayLayer;
+class MapObject;
 
 
 class DetailMap : public Control
@@ -25,6 +30,8 @@ public:
 	void onMouseMove(NAS2D::Point<int> position);
 	void resize(NAS2D::Vector<int>);
 
+	void overlay(const OverlayLayer* overlay, Tile::Overlay overlayType);
+
 	void update() override;
 	void draw() const override;
 
@@ -32,6 +39,64 @@ protected:
 	void drawGrid() const;
 
 private:
+	/**
+	 * Terrain of one excavated tile, ready to draw.
+	 */
+	struct TerrainQuad
+	{
+		NAS2D::Point<int> tilePosition;
+		NAS2D::Point<int> drawPosition;
+		NAS2D::Rectangle<int> subImageRect;
+		Tile::Overlay overlay;
+	};
+
+	/**
+	 * Everything the terrain batch depends on other than the mouse highlight.
+	 */
+	struct TerrainBatchKey
+	{
+		NAS2D::Rectangle<int> viewTileRect;
+		int depth;
+		NAS2D::Point<int> originPixelPosition;
+		std::uint64_t terrainRevision;
+		const OverlayLayer* overlay;
+		Tile::Overlay overlayType;
+		std::uint64_t overlayRevision;
+
+		bool operator==(const TerrainBatchKey&) const = default;
+	};
+
+	/**
+	 * Map object or mine beacon on an excavated tile in view.
+	 */
+	struct VisibleObject
+	{
+		NAS2D::Point<int> drawPosition;
+		MapObject* mapObject; /**< \c nullptr for a mine beacon. */
+	};
+
+	/**
+	 * Everything the visible object list depends on.
+	 */
+	struct VisibleObjectsKey
+	{
+		NAS2D::Rectangle<int> viewTileRect;
+		int depth;
+		NAS2D::Point<int> originPixelPosition;
+		std::uint64_t terrainRevision;
+		std::uint64_t objectRevision;
+
+		bool operator==(const VisibleObjectsKey&) const = default;
+	};
+
+	TerrainBatchKey terrainBatchKey() const;
+	void rebuildTerrainBatch();
+
+	VisibleObjectsKey visibleObjectsKey() const;
+	void rebuildVisibleObjects();
+
+	NAS2D::Point<int> tileDrawPosition(NAS2D::Point<int> tilePosition) const;
+
 	MapView& mMapView;
 	TileMap& mTileMap;
 	const NAS2D::Image mTileset;
@@ -39,4 +104,15 @@ private:
 
 	NAS2D::Point<int> mOriginPixelPosition; // Top pixel at top of diamond
 	NAS2D::Point<int> mMouseTilePosition;
+
+	const OverlayLayer* mOverlay{nullptr};
+	Tile::Overlay mOverlayType{Tile::Overlay::None};
+
+	std::vector<TerrainQuad> mTerrainBatch; /**< Visible terrain in back to front order. */
+	TerrainBatchKey mTerrainBatchKey{};
+	bool mTerrainBatchValid{false};
+
+	std::vector<VisibleObject> mVisibleObjects; /**< Map objects and mine beacons in view, in back to front order. */
+	VisibleObjectsKey mVisibleObjectsKey{};
+	bool mVisibleObjectsValid{false};
 };
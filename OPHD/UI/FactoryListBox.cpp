@@ -26,7 +26,7 @@ namespace
 }
 
 
-static void drawItem(Renderer& renderer, FactoryListBox::FactoryListBoxItem& item, NAS2D::Rectangle<int> rect, bool highlight)
+static void drawItem(Renderer& renderer, const FactoryListBoxItem& item, NAS2D::Rectangle<int> rect, bool highlight)
 {
 	Factory* f = item.factory;
 
@@ -72,9 +72,9 @@ FactoryListBox::FactoryListBox()
  */
 void FactoryListBox::addItem(Factory* factory)
 {
-	for (auto item : mItems)
+	for (const auto& item : mItems)
 	{
-		if (static_cast<FactoryListBoxItem*>(item)->factory == factory)
+		if (item.factory == factory)
 		{
 			throw std::runtime_error("FactoryListBox::addItem(): Can't add factory multiple times");
 		}
@@ -85,7 +85,7 @@ void FactoryListBox::addItem(Factory* factory)
 		(text == constants::UndergroundFactory) ? NAS2D::Point<int>{138, 276} :
 		(text == constants::SeedFactory) ? NAS2D::Point<int>{460, 368} :
 		NAS2D::Point<int>{0, 46}; // Surface factory
-	add<FactoryListBoxItem>(text, factory, iconPosition);
+	add(text, factory, iconPosition);
 }
 
 
@@ -99,8 +99,7 @@ void FactoryListBox::setSelected(Factory* f)
 	if (mItems.empty() || f == nullptr) { return; }
 	for (std::size_t i = 0; i < mItems.size(); ++i)
 	{
-		FactoryListBoxItem* item = static_cast<FactoryListBoxItem*>(mItems[i]);
-		if (item->factory == f)
+		if (mItems[i].factory == f)
 		{
 			setSelection(i);
 			return;
@@ -111,7 +110,7 @@ void FactoryListBox::setSelected(Factory* f)
 
 Factory* FactoryListBox::selectedFactory()
 {
-	return !isItemSelected() ? nullptr : static_cast<FactoryListBoxItem*>(mItems[selectedIndex()])->factory;
+	return !isItemSelected() ? nullptr : mItems[selectedIndex()].factory;
 }
 
 
@@ -128,9 +127,9 @@ void FactoryListBox::update()
 	renderer.clipRect(mRect);
 
 	// ITEMS
-	for (std::size_t i = 0; i < mItems.size(); ++i)
+	for (auto i = firstVisibleIndex(); i < endVisibleIndex(); ++i)
 	{
-		drawItem(renderer, *static_cast<FactoryListBoxItem*>(mItems[i]),
+		drawItem(renderer, mItems[i],
 			{
 				{positionX(),
 				positionY() + (static_cast<int>(i) * LIST_ITEM_HEIGHT) - static_cast<int>(draw_offset())},
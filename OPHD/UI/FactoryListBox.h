@@ -12,25 +12,25 @@
 class Factory;
 
 
+struct FactoryListBoxItem : public ListBoxBase::ListBoxItem
+{
+	FactoryListBoxItem(std::string textDescription, Factory* newFactory, NAS2D::Point<int> iconPosition) :
+		ListBoxItem{textDescription},
+		factory{newFactory},
+		icon_slice{iconPosition}
+	{}
+
+	Factory* factory = nullptr;
+	NAS2D::Point<int> icon_slice;
+};
+
+
 /**
  * Implements a ListBox control.
  */
-class FactoryListBox : public ListBoxBase
+class FactoryListBox : public ListBoxBaseOf<FactoryListBoxItem>
 {
 public:
-	struct FactoryListBoxItem : public ListBoxItem
-	{
-		FactoryListBoxItem(std::string textDescription, Factory* newFactory, NAS2D::Point<int> iconPosition) :
-			ListBoxItem{textDescription},
-			factory{newFactory},
-			icon_slice{iconPosition}
-		{}
-
-		Factory* factory = nullptr;
-		NAS2D::Point<int> icon_slice;
-	};
-
-
 	FactoryListBox();
 
 	void addItem(Factory* factory);
@@ -9,6 +9,8 @@
 #include <NAS2D/Utility.h>
 #include <NAS2D/Renderer/Renderer.h>
 
+#include <utility>
+
 
 using namespace NAS2D;
 
@@ -46,11 +48,22 @@ FactoryProduction::FactoryProduction() :
 void FactoryProduction::clearProduct()
 {
 	mProduct = ProductType::PRODUCT_NONE;
-	mProductCost = {};
+	setProductCost({});
 	mProductGrid.clearSelection();
 }
 
 
+/**
+ * Sets the cost shown in the production table and discards the
+ * cached table so it is rebuilt on the next update.
+ */
+void FactoryProduction::setProductCost(const ProductionCost& cost)
+{
+	mProductCost = cost;
+	mStringTable.reset();
+}
+
+
 void FactoryProduction::hide()
 {
 	Control::hide();
@@ -65,12 +78,12 @@ void FactoryProduction::onProductSelectionChange(const IconGrid::Item* item)
 
 	if (!item)
 	{
-		mProductCost = {};
+		setProductCost({});
 		return;
 	}
 
 	mProduct = static_cast<ProductType>(item->meta);
-	mProductCost = productCost(mProduct);
+	setProductCost(productCost(mProduct));
 }
 
 
@@ -145,7 +158,7 @@ void FactoryProduction::factory(Factory* newFactory)
 	else { mProductGrid.selection_meta(static_cast<int>(mFactory->productType())); }
 
 	mProduct = mFactory->productType();
-	mProductCost = productCost(mFactory->productType());
+	setProductCost(productCost(mFactory->productType()));
 }
 
 
@@ -155,8 +168,19 @@ void FactoryProduction::update()
 
 	Window::update();
 
+	if (!mStringTable || mFactory->productionTurnsCompleted() != mTableTurnsCompleted)
+	{
+		rebuildStringTable();
+	}
+
+	mStringTable->position(mRect.position + NAS2D::Vector{constants::Margin * 2 + mProductGrid.size().x, 25});
+	mStringTable->draw(Utility<Renderer>::get());
+}
+
+
+void FactoryProduction::rebuildStringTable()
+{
 	StringTable stringTable(2, 5);
-	stringTable.position(mRect.position + NAS2D::Vector{constants::Margin * 2 + mProductGrid.size().x, 25});
 	stringTable.setColumnJustification(1, StringTable::Justification::Right);
 
 	stringTable.setColumnText(0,
@@ -179,5 +203,7 @@ void FactoryProduction::update()
 		});
 
 	stringTable.computeRelativeCellPositions();
-	stringTable.draw(Utility<Renderer>::get());
+
+	mStringTable.emplace(std::move(stringTable));
+	mTableTurnsCompleted = mFactory->productionTurnsCompleted();
 }
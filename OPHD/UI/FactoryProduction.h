@@ -4,11 +4,14 @@
 #include <libControls/Button.h>
 #include <libControls/CheckBox.h>
 #include "IconGrid.h"
+#include "StringTable.h"
 
 #include "../Constants/UiConstants.h"
 #include "../Common.h"
 #include "../ProductionCost.h"
 
+#include <optional>
+
 
 class Factory;
 
@@ -36,6 +39,8 @@ private:
 	void onApply();
 
 	void clearProduct();
+	void setProductCost(const ProductionCost& cost);
+	void rebuildStringTable();
 
 	void onProductSelectionChange(const IconGrid::Item*);
 
@@ -44,6 +49,9 @@ private:
 	ProductType mProduct = ProductType::PRODUCT_NONE;
 	ProductionCost mProductCost;
 
+	std::optional<StringTable> mStringTable;
+	int mTableTurnsCompleted{0};
+
 	IconGrid mProductGrid{"ui/factory.png", 32, constants::MarginTight};
 
 	Button btnOkay{"Okay", {this, &FactoryProduction::onOkay}};
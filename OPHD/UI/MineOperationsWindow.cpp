@@ -1,6 +1,5 @@
 #include "MineOperationsWindow.h"
 
-#include "StringTable.h"
 #include "TextRender.h"
 
 #include "../Cache.h"
@@ -20,6 +20,18 @@ namespace
 {
 	const std::string MapTerrainExtension = "_a.png";
 	const std::string MapDisplayExtension = "_b.png";
+
+	const auto CommandCenterIconRect = NAS2D::Rectangle<int>{{166, 226}, {30, 30}};
+	const auto CommTowerIconRect = NAS2D::Rectangle<int>{{146, 236}, {20, 20}};
+
+
+	NAS2D::Color blend(NAS2D::Color destination, NAS2D::Color source)
+	{
+		const auto mix = [alpha = source.alpha](std::uint8_t to, std::uint8_t from) {
+			return static_cast<std::uint8_t>((from * alpha + to * (255 - alpha)) / 255);
+		};
+		return {mix(destination.red, source.red), mix(destination.green, source.green), mix(destination.blue, source.blue), destination.alpha};
+	}
 }
 
 
@@ -30,7 +42,16 @@ MiniMap::MiniMap(MapView& mapView, TileMap* tileMap, const std::map<Robot*, Tile
 	mIsHeightMapVisible{false},
 	mBackgroundSatellite{mapName + MapDisplayExtension},
 	mBackgroundHeightMap{mapName + MapTerrainExtension},
-	mUiIcons{imageCache.load("ui/icons.png")}
+	mUiIcons{imageCache.load("ui/icons.png")},
+	mSatellitePixels{readPixels(mBackgroundSatellite, {{0, 0}, mBackgroundSatellite.size()})},
+	mHeightMapPixels{readPixels(mBackgroundHeightMap, {{0, 0}, mBackgroundHeightMap.size()})},
+	mCommandCenterIcon{readPixels(mUiIcons, CommandCenterIconRect)},
+	mCommTowerIcon{readPixels(mUiIcons, CommTowerIconRect)},
+	mMineIcons{
+		readPixels(mUiIcons, {{0, 0}, {7, 7}}),
+		readPixels(mUiIcons, {{8, 0}, {7, 7}}),
+		readPixels(mUiIcons, {{16, 0}, {7, 7}})
+	}
 {}
 
 
@@ -46,6 +67,30 @@ void MiniMap::heightMapVisible(bool isVisible)
 }
 
 
+/**
+ * Marks the marker layer out of date.
+ *
+ * Adding or removing map objects is detected automatically. This is for
+ * changes that aren't, like routes, mine status and structure states,
+ * and is called once per turn.
+ */
+void MiniMap::invalidateLayer()
+{
+	mLayerValid = false;
+}
+
+
+void MiniMap::update()
+{
+	if (!isLayerCurrent())
+	{
+		rebuildLayer();
+	}
+
+	draw();
+}
+
+
 /**
  * Draws the minimap and all icons/overlays for it.
  */
@@ -55,16 +100,104 @@ void MiniMap::draw() const
 	const auto miniMapFloatRect = mRect.to<float>();
 	renderer.clipRect(miniMapFloatRect);
 
-	renderer.drawImage((mIsHeightMapVisible ? mBackgroundHeightMap : mBackgroundSatellite), miniMapFloatRect.position);
+	if (mLayer)
+	{
+		renderer.drawImage(*mLayer, miniMapFloatRect.position);
+	}
+	else
+	{
+		renderer.drawImage((mIsHeightMapVisible ? mBackgroundHeightMap : mBackgroundSatellite), miniMapFloatRect.position);
+	}
 
-	auto& structureManager = NAS2D::Utility<StructureManager>::get();
 	const auto miniMapOffset = mRect.position - NAS2D::Point{0, 0};
+	const auto& viewTileRect = mMapView.viewTileRect();
+	renderer.drawBox(viewTileRect.translate(miniMapOffset + NAS2D::Vector{1, 1}), NAS2D::Color{0, 0, 0, 180});
+	renderer.drawBox(viewTileRect.translate(miniMapOffset), NAS2D::Color::White);
+
+	renderer.clipRectClear();
+}
+
+
+MiniMap::PixelBuffer MiniMap::readPixels(const NAS2D::Image& image, const NAS2D::Rectangle<int>& rect)
+{
+	PixelBuffer buffer{rect.size, {}};
+	buffer.pixels.reserve(static_cast<std::size_t>(rect.size.x * rect.size.y));
+	for (int y = 0; y < rect.size.y; ++y)
+	{
+		for (int x = 0; x < rect.size.x; ++x)
+		{
+			buffer.pixels.push_back(image.pixelColor(rect.position + NAS2D::Vector{x, y}));
+		}
+	}
+	return buffer;
+}
+
+
+/**
+ * Alpha blends \c icon onto the layer with its top left corner at \c position.
+ */
+void MiniMap::stamp(const PixelBuffer& icon, NAS2D::Point<int> position)
+{
+	for (int y = 0; y < icon.size.y; ++y)
+	{
+		for (int x = 0; x < icon.size.x; ++x)
+		{
+			const auto layerPosition = position + NAS2D::Vector{x, y};
+			if (layerPosition.x < 0 || layerPosition.y < 0 || layerPosition.x >= mLayerPixels.size.x || layerPosition.y >= mLayerPixels.size.y) { continue; }
+
+			auto& pixel = mLayerPixels.pixels[static_cast<std::size_t>(layerPosition.y * mLayerPixels.size.x + layerPosition.x)];
+			pixel = blend(pixel, icon.pixels[static_cast<std::size_t>(y * icon.size.x + x)]);
+		}
+	}
+}
+
+
+void MiniMap::fill(const NAS2D::Rectangle<int>& rect, NAS2D::Color color)
+{
+	for (int y = 0; y < rect.size.y; ++y)
+	{
+		for (int x = 0; x < rect.size.x; ++x)
+		{
+			plot(rect.position + NAS2D::Vector{x, y}, color);
+		}
+	}
+}
+
+
+void MiniMap::plot(NAS2D::Point<int> position, NAS2D::Color color)
+{
+	if (position.x < 0 || position.y < 0 || position.x >= mLayerPixels.size.x || position.y >= mLayerPixels.size.y) { return; }
+
+	auto& pixel = mLayerPixels.pixels[static_cast<std::size_t>(position.y * mLayerPixels.size.x + position.x)];
+	pixel = blend(pixel, color);
+}
+
+
+bool MiniMap::isLayerCurrent() const
+{
+	return mLayerValid &&
+		mLayerHeightMapVisible == mIsHeightMapVisible &&
+		mLayerObjectRevision == Tile::objectRevision();
+}
+
+
+/**
+ * Composites the background and every marker into one image so that
+ * drawing the minimap is a single image draw.
+ */
+void MiniMap::rebuildLayer()
+{
+	mLayerValid = true;
+	mLayerHeightMapVisible = mIsHeightMapVisible;
+	mLayerObjectRevision = Tile::objectRevision();
+
+	mLayerPixels = mIsHeightMapVisible ? mHeightMapPixels : mSatellitePixels;
+
+	auto& structureManager = NAS2D::Utility<StructureManager>::get();
 	for (const auto& ccPosition : structureManager.operationalCommandCenterPositions())
 	{
-		const auto ccOffsetPosition = ccPosition.xy + miniMapOffset;
-		const auto ccCommRangeImageRect = NAS2D::Rectangle<int>{{166, 226}, {30, 30}};
-		renderer.drawSubImage(mUiIcons, ccOffsetPosition - ccCommRangeImageRect.size / 2, ccCommRangeImageRect);
-		renderer.drawBoxFilled(NAS2D::Rectangle{ccOffsetPosition - NAS2D::Vector{1, 1}, {3, 3}}, NAS2D::Color::White);
+		stamp(mCommandCenterIcon, ccPosition.xy - CommandCenterIconRect.size / 2);
+		fill(NAS2D::Rectangle{ccPosition.xy - NAS2D::Vector{1, 1}, {3, 3}}, NAS2D::Color::White);
 	}
 
 	for (auto commTower : structureManager.getStructures<CommTower>())
@@ -72,8 +205,7 @@ void MiniMap::draw() const
 		if (commTower->operational())
 		{
 			const auto commTowerPosition = structureManager.tileFromStructure(commTower).xy();
-			const auto commTowerRangeImageRect = NAS2D::Rectangle<int>{{146, 236}, {20, 20}};
-			renderer.drawSubImage(mUiIcons, commTowerPosition + miniMapOffset - commTowerRangeImageRect.size / 2, commTowerRangeImageRect);
+			stamp(mCommTowerIcon, commTowerPosition - CommTowerIconRect.size / 2);
 		}
 	}
 
@@ -82,38 +214,29 @@ void MiniMap::draw() const
 		Mine* mine = mTileMap->getTile({minePosition, 0}).mine();
 		if (!mine) { break; } // avoids potential race condition where a mine is destroyed during an updated cycle.
 
-		auto mineBeaconStatusOffsetX = 0;
-		if (!mine->active()) { mineBeaconStatusOffsetX = 0; }
-		else if (!mine->exhausted()) { mineBeaconStatusOffsetX = 8; }
-		else { mineBeaconStatusOffsetX = 16; }
+		std::size_t mineIcon = 0;
+		if (!mine->active()) { mineIcon = 0; }
+		else if (!mine->exhausted()) { mineIcon = 1; }
+		else { mineIcon = 2; }
 
-		const auto mineImageRect = NAS2D::Rectangle<int>{{mineBeaconStatusOffsetX, 0}, {7, 7}};
-		renderer.drawSubImage(mUiIcons, minePosition + miniMapOffset - NAS2D::Vector{2, 2}, mineImageRect);
+		stamp(mMineIcons[mineIcon], minePosition - NAS2D::Vector{2, 2});
 	}
 
-	// Temporary debug aid, will be slow with high numbers of mines
-	// especially with routes of longer lengths.
 	auto& routeTable = NAS2D::Utility<std::map<class MineFacility*, Route>>::get();
-	for (auto route : routeTable)
+	for (auto& route : routeTable)
 	{
 		for (auto tile : route.second.path)
 		{
-			const auto tilePosition = static_cast<Tile*>(tile)->xy();
-			renderer.drawPoint(tilePosition + miniMapOffset, NAS2D::Color::Magenta);
+			plot(static_cast<Tile*>(tile)->xy(), NAS2D::Color::Magenta);
 		}
 	}
 
 	for (auto robotEntry : mRobotList)
 	{
-		const auto robotPosition = robotEntry.second->xy();
-		renderer.drawPoint(robotPosition + miniMapOffset, NAS2D::Color::Cyan);
+		plot(robotEntry.second->xy(), NAS2D::Color::Cyan);
 	}
 
-	const auto& viewTileRect = mMapView.viewTileRect();
-	renderer.drawBox(viewTileRect.translate(miniMapOffset + NAS2D::Vector{1, 1}), NAS2D::Color{0, 0, 0, 180});
-	renderer.drawBox(viewTileRect.translate(miniMapOffset), NAS2D::Color::White);
-
-	renderer.clipRectClear();
+	mLayer = std::make_unique<NAS2D::Image>(mLayerPixels.pixels.data(), 4, mLayerPixels.size);
 }
 
 
@@ -7,9 +7,14 @@
 #include <NAS2D/EventHandler.h>
 #include <NAS2D/Math/Point.h>
 #include <NAS2D/Math/Vector.h>
+#include <NAS2D/Renderer/Color.h>
 
+#include <array>
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 
 class Tile;
@@ -27,6 +32,9 @@ public:
 	bool heightMapVisible() const;
 	void heightMapVisible(bool isVisible);
 
+	void invalidateLayer();
+
+	void update() override;
 	void draw() const override;
 
 protected:
@@ -37,6 +45,25 @@ protected:
 	void onMouseMove(NAS2D::Point<int> position, NAS2D::Vector<int> relative);
 	void onSetView(NAS2D::Point<int> mousePixel);
 
+private:
+	/**
+	 * Pixels of a CPU side image, one NAS2D::Color per pixel row by row.
+	 */
+	struct PixelBuffer
+	{
+		NAS2D::Vector<int> size{0, 0};
+		std::vector<NAS2D::Color> pixels;
+	};
+
+	static PixelBuffer readPixels(const NAS2D::Image& image, const NAS2D::Rectangle<int>& rect);
+
+	void stamp(const PixelBuffer& icon, NAS2D::Point<int> position);
+	void fill(const NAS2D::Rectangle<int>& rect, NAS2D::Color color);
+	void plot(NAS2D::Point<int> position, NAS2D::Color color);
+
+	bool isLayerCurrent() const;
+	void rebuildLayer();
+
 private:
 	MapView& mMapView;
 	TileMap* mTileMap;
@@ -46,4 +73,16 @@ private:
 	NAS2D::Image mBackgroundHeightMap;
 	const NAS2D::Image& mUiIcons;
 	bool mLeftButtonDown{false};
+
+	PixelBuffer mSatellitePixels;
+	PixelBuffer mHeightMapPixels;
+	PixelBuffer mCommandCenterIcon;
+	PixelBuffer mCommTowerIcon;
+	std::array<PixelBuffer, 3> mMineIcons; /**< Inactive, active and exhausted. */
+
+	PixelBuffer mLayerPixels; /**< Background with all markers composited onto it. */
+	std::unique_ptr<NAS2D::Image> mLayer;
+	bool mLayerValid{false};
+	bool mLayerHeightMapVisible{false};
+	std::uint64_t mLayerObjectRevision{0};
 };
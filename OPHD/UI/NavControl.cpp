@@ -32,7 +32,9 @@ namespace
 NavControl::NavControl(MapView& mapView, TileMap& tileMap) :
 	mMapView{mapView},
 	mTileMap{tileMap},
-	mUiIcons{imageCache.load("ui/icons.png")}
+	mUiIcons{imageCache.load("ui/icons.png")},
+	mFont{fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal)},
+	mFontBoldMedium{fontCache.load(constants::FONT_PRIMARY_BOLD, constants::FontPrimaryMedium)}
 {
 	onMove({0, 0});
 }
@@ -102,22 +104,20 @@ void NavControl::draw() const
 	}
 
 	// Display the levels "bar"
-	const auto& font = fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal);
-	const auto stepSizeWidth = font.width("IX");
+	const auto stepSizeWidth = mFont.width("IX");
 	auto position = mRect.endPoint() - NAS2D::Vector{5, 30 - constants::Margin};
 	for (int i = mTileMap.maxDepth(); i >= 0; i--)
 	{
 		const auto levelString = (i == 0) ? std::string{"S"} : std::to_string(i);
-		const auto textSize = font.size(levelString);
+		const auto textSize = mFont.size(levelString);
 		bool isCurrentDepth = i == mMapView.currentDepth();
 		NAS2D::Color color = isCurrentDepth ? NAS2D::Color::Red : NAS2D::Color{200, 200, 200};
-		renderer.drawText(font, levelString, position - textSize, color);
+		renderer.drawText(mFont, levelString, position - textSize, color);
 		position.x -= stepSizeWidth;
 	}
 
 	// Explicit current level
 	const auto& currentLevelString = LevelStringTable[mMapView.currentDepth()];
-	const auto& fontBoldMedium = fontCache.load(constants::FONT_PRIMARY_BOLD, constants::FontPrimaryMedium);
-	const auto currentLevelPosition = mRect.endPoint() - fontBoldMedium.size(currentLevelString) - NAS2D::Vector{constants::Margin, constants::Margin};
-	renderer.drawText(fontBoldMedium, currentLevelString, currentLevelPosition, NAS2D::Color::White);
+	const auto currentLevelPosition = mRect.endPoint() - mFontBoldMedium.size(currentLevelString) - NAS2D::Vector{constants::Margin, constants::Margin};
+	renderer.drawText(mFontBoldMedium, currentLevelString, currentLevelPosition, NAS2D::Color::White);
 }
@@ -9,6 +9,7 @@
 
 namespace NAS2D
 {
+	class Font;
 	class Image;
 }
 
@@ -34,6 +35,8 @@ private:
 	MapView& mMapView;
 	TileMap& mTileMap;
 	const NAS2D::Image& mUiIcons;
+	const NAS2D::Font& mFont;
+	const NAS2D::Font& mFontBoldMedium;
 
 	NAS2D::Rectangle<int> mMoveNorthIconRect;
 	NAS2D::Rectangle<int> mMoveSouthIconRect;
@@ -36,16 +36,13 @@ void ProductListBox::productPool(ProductPool& pool)
 
 		if (productCount > 0)
 		{
-			ProductListBoxItem* item = new ProductListBoxItem();
-			item->text = ProductCatalogue::get(productType).Name;
-			item->count = productCount;
-			item->capacityUsed = productCount * pool.productStorageRequirement(productType);
-			item->capacityTotal = pool.capacity();
-			mItems.push_back(item);
+			auto& item = add();
+			item.text = ProductCatalogue::get(productType).Name;
+			item.count = productCount;
+			item.capacityUsed = productCount * pool.productStorageRequirement(productType);
+			item.capacityTotal = pool.capacity();
 		}
 	}
-
-	updateScrollLayout();
 }
 
 
@@ -70,9 +67,9 @@ void ProductListBox::update()
 	const auto offset = static_cast<int>(draw_offset());
 	const auto x = positionX();
 
-	for (std::size_t i = 0; i < mItems.size(); ++i)
+	for (auto i = firstVisibleIndex(); i < endVisibleIndex(); ++i)
 	{
-		const auto& item = *static_cast<ProductListBoxItem*>(mItems[i]);
+		const auto& item = mItems[i];
 		const auto y = positionY() + (static_cast<int>(i) * itemSize.y);
 		const auto highlight = i == selectedIndex();
 
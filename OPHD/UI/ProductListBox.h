@@ -11,19 +11,20 @@ namespace NAS2D
 class ProductPool;
 
 
+struct ProductListBoxItem : public ListBoxBase::ListBoxItem
+{
+	int count = 0; /**< Count of the product. */
+	int capacityUsed = 0;
+	int capacityTotal = 0;
+};
+
+
 /**
  * Specialized ListBox to display a list of products in a ProductPool.
  */
-class ProductListBox : public ListBoxBase
+class ProductListBox : public ListBoxBaseOf<ProductListBoxItem>
 {
 public:
-	struct ProductListBoxItem : public ListBoxItem
-	{
-		int count = 0; /**< Count of the product. */
-		int capacityUsed = 0;
-		int capacityTotal = 0;
-	};
-
 	ProductListBox();
 
 	void productPool(ProductPool&);
@@ -112,7 +112,7 @@ void WarehouseReport::fillListFromStructureList(const std::vector<Warehouse*>& w
 	for (auto warehouse : warehouses)
 	{
 		lstStructures.addItem(warehouse);
-		StructureListBox::StructureListBoxItem* item = lstStructures.last();
+		StructureListBoxItem* item = lstStructures.last();
 
 		// \fixme	Abuse of interface to achieve custom results.
 		ProductPool& products = warehouse->products();
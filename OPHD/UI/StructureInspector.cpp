@@ -29,18 +29,33 @@ StructureInspector::StructureInspector() :
 void StructureInspector::structure(Structure* structure)
 {
 	mStructure = structure;
+	invalidateTables();
 
 	if (!mStructure) { return; }
 
-	auto stringTable = buildStringTable();
+	rebuildTables();
 
-	auto windowWidth = stringTable.screenRect().size.x + 10;
+	auto windowWidth = mStringTable->screenRect().size.x + 10;
 	size({windowWidth < 350 ? 350 : windowWidth, rect().size.y});
 
 	btnClose.position({positionX() + rect().size.x - 55, btnClose.positionY()});
 }
 
 
+/**
+ * Discards the cached tables so they are rebuilt on the next update.
+ *
+ * \note	Tables are rebuilt automatically when the structure's state
+ *			revision changes. Call this when a turn ends to pick up
+ *			changes that are not tracked by the revision.
+ */
+void StructureInspector::invalidateTables()
+{
+	mStringTable.reset();
+	mStructureTable.reset();
+}
+
+
 void StructureInspector::onClose()
 {
 	visible(false);
@@ -124,20 +139,30 @@ void StructureInspector::update()
 	}
 	title(mStructure->name());
 
-	auto stringTable = buildStringTable();
-	stringTable.draw(renderer);
+	if (!mStringTable || mStructure->stateRevision() != mTableRevision)
+	{
+		rebuildTables();
+	}
+
+	mStringTable->position(mRect.position + NAS2D::Vector{5, 25});
+	mStringTable->draw(renderer);
 
-	drawStructureSpecificTable({stringTable.position().x, stringTable.screenRect().endPoint().y + 25}, renderer);
+	mStructureTable->position({mStringTable->position().x, mStringTable->screenRect().endPoint().y + 25});
+	mStructureTable->draw(renderer);
 }
 
-void StructureInspector::drawStructureSpecificTable(NAS2D::Point<int> position, NAS2D::Renderer& renderer)
+
+void StructureInspector::rebuildTables()
 {
-	StringTable stringTable = mStructure->createInspectorViewTable();
-	stringTable.computeRelativeCellPositions();
-	stringTable.position(position);
-	stringTable.draw(renderer);
+	mStringTable.emplace(buildStringTable());
+
+	mStructureTable.emplace(mStructure->createInspectorViewTable());
+	mStructureTable->computeRelativeCellPositions();
+
+	mTableRevision = mStructure->stateRevision();
 }
 
+
 std::string StructureInspector::getDisabledReason() const
 {
 	if (mStructure->disabled())
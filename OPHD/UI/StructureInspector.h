@@ -1,14 +1,18 @@
 #pragma once
 
+#include "StringTable.h"
+
 #include <libControls/Window.h>
 #include <libControls/Button.h>
 
 #include <NAS2D/Renderer/Renderer.h>
 #include <NAS2D/Math/Point.h>
 
+#include <cstdint>
+#include <optional>
+
 
 class Structure;
-class StringTable;
 
 
 class StructureInspector : public Window
@@ -19,17 +23,23 @@ public:
 	void structure(Structure* structure);
 	Structure* structure() { return mStructure; }
 
+	void invalidateTables();
+
 	void update() override;
 
 private:
 	void onClose();
 	std::string getDisabledReason() const;
-	void drawStructureSpecificTable(NAS2D::Point<int> position, NAS2D::Renderer& renderer);
 	std::string formatAge() const;
 
 	StringTable buildStringTable() const;
+	void rebuildTables();
 
 	Button btnClose;
 	const NAS2D::Image& mIcons;
 	Structure* mStructure = nullptr;
+
+	std::optional<StringTable> mStringTable;
+	std::optional<StringTable> mStructureTable;
+	std::uint64_t mTableRevision{0};
 };
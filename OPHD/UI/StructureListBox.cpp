@@ -19,7 +19,7 @@ static const Font* MAIN_FONT = nullptr;
 static const Font* MAIN_FONT_BOLD = nullptr;
 
 
-static void drawItem(Renderer& renderer, StructureListBox::StructureListBoxItem& item, NAS2D::Rectangle<int> rect, bool highlight)
+static void drawItem(Renderer& renderer, const StructureListBoxItem& item, NAS2D::Rectangle<int> rect, bool highlight)
 {
 	const auto structureState = item.structure->state();
 	const auto& structureColor = structureColorFromIndex(structureState);
@@ -35,7 +35,7 @@ static void drawItem(Renderer& renderer, StructureListBox::StructureListBoxItem&
 }
 
 
-StructureListBox::StructureListBoxItem::StructureListBoxItem(Structure* s) :
+StructureListBoxItem::StructureListBoxItem(Structure* s) :
 	ListBoxItem{s->name()},
 	structure{s},
 	structureState{""},
@@ -58,15 +58,15 @@ StructureListBox::StructureListBox()
  */
 void StructureListBox::addItem(Structure* structure)
 {
-	for (auto item : mItems)
+	for (const auto& item : mItems)
 	{
-		if (static_cast<StructureListBoxItem*>(item)->structure == structure)
+		if (item.structure == structure)
 		{
 			throw std::runtime_error("StructureListBox::addItem(): Can't add structure multiple times");
 		}
 	}
 
-	add<StructureListBoxItem>(structure);
+	add(structure);
 }
 
 
@@ -81,8 +81,7 @@ void StructureListBox::setSelected(Structure* structure)
 
 	for (std::size_t i = 0; i < mItems.size(); ++i)
 	{
-		StructureListBoxItem* item = static_cast<StructureListBoxItem*>(mItems[i]);
-		if (item->structure == structure)
+		if (mItems[i].structure == structure)
 		{
 			setSelection(i);
 			return;
@@ -93,16 +92,18 @@ void StructureListBox::setSelected(Structure* structure)
 
 Structure* StructureListBox::selectedStructure()
 {
-	return !isItemSelected() ? nullptr : static_cast<StructureListBoxItem*>(mItems[selectedIndex()])->structure;
+	return !isItemSelected() ? nullptr : mItems[selectedIndex()].structure;
 }
 
 
 /**
  * Convenience function to get the last item in the list.
+ *
+ * \note	The returned pointer is invalidated when another item is added.
  */
-StructureListBox::StructureListBoxItem* StructureListBox::last()
+StructureListBoxItem* StructureListBox::last()
 {
-	return static_cast<StructureListBoxItem*>(mItems.back());
+	return &mItems.back();
 }
 
 
@@ -119,9 +120,9 @@ void StructureListBox::update()
 	renderer.clipRect(mRect);
 
 	// ITEMS
-	for (std::size_t i = 0; i < mItems.size(); ++i)
+	for (auto i = firstVisibleIndex(); i < endVisibleIndex(); ++i)
 	{
-		drawItem(renderer, *static_cast<StructureListBoxItem*>(mItems[i]),
+		drawItem(renderer, mItems[i],
 			{
 				{positionX(),
 				positionY() + (static_cast<int>(i) * LIST_ITEM_HEIGHT) - static_cast<int>(draw_offset())},
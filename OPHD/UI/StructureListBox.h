@@ -10,24 +10,24 @@
 class Structure;
 
 
+struct StructureListBoxItem : public ListBoxBase::ListBoxItem
+{
+	StructureListBoxItem(Structure* s);
+
+	Structure* structure = nullptr; /**< Pointer to a Structure. */
+	std::string structureState; /**< String description of the state of a Structure. */
+	StructureState colorIndex; /**< Index to use from the listbox color table. */
+};
+
+
 /**
  * Implements a ListBox control.
  */
-class StructureListBox : public ListBoxBase
+class StructureListBox : public ListBoxBaseOf<StructureListBoxItem>
 {
 public:
 	using SelectionChangedSignal = NAS2D::Signal<Structure*>;
 
-	struct StructureListBoxItem : public ListBoxItem
-	{
-		StructureListBoxItem(Structure* s);
-
-		Structure* structure = nullptr; /**< Pointer to a Structure. */
-		std::string structureState; /**< String description of the state of a Structure. */
-		StructureState colorIndex; /**< Index to use from the listbox color table. */
-	};
-
-
 	StructureListBox();
 
 	void addItem(Structure*);
@@ -8,38 +8,56 @@
 #include <NAS2D/Utility.h>
 
 
+namespace
+{
+	struct LabelFonts
+	{
+		const NAS2D::Font& label;
+		const NAS2D::Font& value;
+	};
+
+
+	/**
+	 * Fonts are resolved once on first use instead of being looked up
+	 * in the font cache on every call.
+	 */
+	const LabelFonts& labelFonts()
+	{
+		static const LabelFonts fonts{
+			fontCache.load(constants::FONT_PRIMARY_BOLD, constants::FontPrimaryNormal),
+			fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal)
+		};
+		return fonts;
+	}
+}
+
+
 void drawLabelAndValue(NAS2D::Point<int> position, const std::string& title, const std::string& text, NAS2D::Color color)
 {
 	auto& renderer = NAS2D::Utility<NAS2D::Renderer>::get();
+	const auto& fonts = labelFonts();
 
-	const NAS2D::Font* FONT = &fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal);
-	const NAS2D::Font* FONT_BOLD = &fontCache.load(constants::FONT_PRIMARY_BOLD, constants::FontPrimaryNormal);
-
-	renderer.drawText(*FONT_BOLD, title, position, color);
-	position.x += FONT_BOLD->width(title);
-	renderer.drawText(*FONT, text, position, color);
+	renderer.drawText(fonts.label, title, position, color);
+	position.x += fonts.label.width(title);
+	renderer.drawText(fonts.value, text, position, color);
 }
 
 void drawLabelAndValueLeftJustify(NAS2D::Point<int> position, int labelWidth, const std::string& title, const std::string& text, NAS2D::Color color)
 {
 	auto& renderer = NAS2D::Utility<NAS2D::Renderer>::get();
+	const auto& fonts = labelFonts();
 
-	const NAS2D::Font* FONT = &fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal);
-	const NAS2D::Font* FONT_BOLD = &fontCache.load(constants::FONT_PRIMARY_BOLD, constants::FontPrimaryNormal);
-
-	renderer.drawText(*FONT_BOLD, title, position, color);
+	renderer.drawText(fonts.label, title, position, color);
 	position.x += labelWidth;
-	renderer.drawText(*FONT, text, position, color);
+	renderer.drawText(fonts.value, text, position, color);
 }
 
 void drawLabelAndValueRightJustify(NAS2D::Point<int> position, int labelWidth, const std::string& title, const std::string& text, NAS2D::Color color)
 {
 	auto& renderer = NAS2D::Utility<NAS2D::Renderer>::get();
+	const auto& fonts = labelFonts();
 
-	const NAS2D::Font* FONT = &fontCache.load(constants::FONT_PRIMARY, constants::FontPrimaryNormal);
-	const NAS2D::Font* FONT_BOLD = &fontCache.load(constants::FONT_PRIMARY_BOLD, constants::FontPrimaryNormal);
-
-	renderer.drawText(*FONT_BOLD, title, position, color);
-	position.x += labelWidth - FONT->width(text);
-	renderer.drawText(*FONT, text, position, color);
+	renderer.drawText(fonts.label, title, position, color);
+	position.x += labelWidth - fonts.value.width(text);
+	renderer.drawText(fonts.value, text, position, color);
 }
@@ -26,6 +26,7 @@ WarehouseInspector::WarehouseInspector() :
 void WarehouseInspector::warehouse(Warehouse* w)
 {
 	mWarehouse = w;
+	mRowsWarehouse = nullptr;
 }
 
 
@@ -39,6 +40,7 @@ void WarehouseInspector::hide()
 {
 	Control::hide();
 	mWarehouse = nullptr;
+	mRowsWarehouse = nullptr;
 }
 
 
@@ -48,28 +50,43 @@ void WarehouseInspector::update()
 
 	Window::update();
 
-	ProductPool& pool = mWarehouse->products();
+	// Rows only change when products are stored or pulled
+	if (mRowsWarehouse != mWarehouse || mRowsCounts != mWarehouse->products().counts())
+	{
+		rebuildRows();
+	}
 
 	const int labelWidth = 100;
 
 	auto position = mRect.position + NAS2D::Vector{constants::Margin, 25};
-	drawLabelAndValueLeftJustify(position, labelWidth, "Storage:", std::to_string(pool.availableStorage()) + " / " + std::to_string(pool.capacity()));
+	drawLabelAndValueLeftJustify(position, labelWidth, "Storage:", mStorageText);
 
 	position.y += 25;
 
-	/**
-	 * This could be further improved by caching which products are going to be
-	 * displayed and looping through those instead of looping through all 64
-	 * products every frame.
-	 */
+	for (const auto& [label, value] : mProductRows)
+	{
+		drawLabelAndValueLeftJustify(position, labelWidth, label, value);
+		position.y += 15;
+	}
+}
+
+
+void WarehouseInspector::rebuildRows()
+{
+	ProductPool& pool = mWarehouse->products();
+
+	mStorageText = std::to_string(pool.availableStorage()) + " / " + std::to_string(pool.capacity());
+
+	mProductRows.clear();
 	for (size_t i = 0; i < ProductType::PRODUCT_COUNT; ++i)
 	{
 		const auto productType = static_cast<ProductType>(i);
 		if (pool.count(productType) == 0) { continue; }
 		if (storageRequiredPerUnit(productType) == 0) { continue; }
 
-		drawLabelAndValueLeftJustify(position, labelWidth, ProductCatalogue::get(productType).Name + ":", std::to_string(pool.count(productType)));
-
-		position.y += 15;
+		mProductRows.emplace_back(ProductCatalogue::get(productType).Name + ":", std::to_string(pool.count(productType)));
 	}
+
+	mRowsWarehouse = mWarehouse;
+	mRowsCounts = pool.counts();
 }
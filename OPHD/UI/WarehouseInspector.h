@@ -1,8 +1,14 @@
 #pragma once
 
+#include "../ProductPool.h"
+
 #include <libControls/Window.h>
 #include <libControls/Button.h>
 
+#include <string>
+#include <utility>
+#include <vector>
+
 
 class Warehouse;
 
@@ -22,7 +28,13 @@ public:
 
 private:
 	void onClose();
+	void rebuildRows();
 
 	Warehouse* mWarehouse = nullptr;
 	Button btnClose;
+
+	std::string mStorageText;
+	std::vector<std::pair<std::string, std::string>> mProductRows; /**< Label and count of each stored product. */
+	const Warehouse* mRowsWarehouse = nullptr; /**< Warehouse the rows were built from. */
+	ProductPool::ProductTypeCount mRowsCounts{}; /**< Product counts the rows were built from. */
 };
@@ -0,0 +1,161 @@
+#include "WarehouseInventory.h"
+
+#include "MapObjects/Structures/Warehouse.h"
+
+#include <stdexcept>
+
+
+void WarehouseInventory::insert(Warehouse& warehouse)
+{
+	if (mRecords.find(&warehouse) != mRecords.end())
+	{
+		throw std::runtime_error("WarehouseInventory::insert(): Warehouse is already tracked");
+	}
+
+	auto& record = mRecords[&warehouse];
+	record.order = mNextOrder++;
+	track(warehouse, record, 1);
+}
+
+
+void WarehouseInventory::remove(Warehouse& warehouse)
+{
+	const auto it = mRecords.find(&warehouse);
+	if (it == mRecords.end())
+	{
+		throw std::runtime_error("WarehouseInventory::remove(): Warehouse is not tracked");
+	}
+
+	track(warehouse, it->second, -1);
+	mRecords.erase(it);
+}
+
+
+void WarehouseInventory::clear()
+{
+	mRecords.clear();
+	mFreeStorage.clear();
+	for (auto& stock : mStock) { stock.clear(); }
+	mTotals = {};
+	mAvailableStoragePercentTotal = 0;
+}
+
+
+/**
+ * Reads the current products of a warehouse into the inventory.
+ */
+void WarehouseInventory::update(Warehouse& warehouse)
+{
+	auto& record = mRecords.at(&warehouse);
+	track(warehouse, record, -1);
+	track(warehouse, record, 1);
+}
+
+
+/**
+ * Number of products of a given type across all warehouses.
+ */
+int WarehouseInventory::count(ProductType type) const
+{
+	return mTotals[type];
+}
+
+
+/**
+ * Finds the operational warehouse with the most available storage.
+ *
+ * \return	The warehouse or \c nullptr if no operational warehouse can store
+ *			\c count products of \c type.
+ */
+Warehouse* WarehouseInventory::findStorage(ProductType type, int count) const
+{
+	for (const auto& entry : mFreeStorage)
+	{
+		if (!entry.warehouse->operational()) { continue; }
+
+		// No other operational warehouse has more space than this one
+		return entry.warehouse->products().canStore(type, count) ? entry.warehouse : nullptr;
+	}
+
+	return nullptr;
+}
+
+
+/**
+ * Stores products in the operational warehouse with the most available storage.
+ *
+ * \return	True if the products were stored.
+ */
+bool WarehouseInventory::store(ProductType type, int count)
+{
+	auto* warehouse = findStorage(type, count);
+	if (!warehouse) { return false; }
+
+	warehouse->products().store(type, count);
+	update(*warehouse);
+	return true;
+}
+
+
+/**
+ * Pulls up to \c count products of \c type from warehouses in the order
+ * the warehouses were built.
+ *
+ * \return	Number of products pulled.
+ */
+int WarehouseInventory::pull(ProductType type, int count)
+{
+	int pulled = 0;
+	auto& stock = mStock[type];
+	for (auto it = stock.begin(); it != stock.end() && pulled < count;)
+	{
+		auto* warehouse = it->second;
+		++it;
+
+		pulled += warehouse->products().pull(type, count - pulled);
+		update(*warehouse);
+	}
+	return pulled;
+}
+
+
+/**
+ * Mean of the available storage percent of every warehouse.
+ */
+int WarehouseInventory::meanAvailableStoragePercent() const
+{
+	if (mRecords.empty()) { return 0; }
+	return mAvailableStoragePercentTotal / static_cast<int>(mRecords.size());
+}
+
+
+/**
+ * Adds (\c sign of 1) or removes (\c sign of -1) a warehouse's record from
+ * the indexes. Adding first refreshes the record from the warehouse.
+ */
+void WarehouseInventory::track(Warehouse& warehouse, Record& record, int sign)
+{
+	if (sign > 0)
+	{
+		const auto& products = warehouse.products();
+		record.products = products.counts();
+		record.availableStorage = products.availableStorage();
+		record.availableStoragePercent = products.availableStoragePercent();
+		mFreeStorage.insert({record.availableStorage, record.order, &warehouse});
+	}
+	else
+	{
+		mFreeStorage.erase({record.availableStorage, record.order, &warehouse});
+	}
+
+	for (std::size_t type = 0; type < record.products.size(); ++type)
+	{
+		if (record.products[type] == 0) { continue; }
+
+		mTotals[type] += sign * record.products[type];
+		if (sign > 0) { mStock[type][record.order] = &warehouse; }
+		else { mStock[type].erase(record.order); }
+	}
+
+	mAvailableStoragePercentTotal += sign * record.availableStoragePercent;
+}
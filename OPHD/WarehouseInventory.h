@@ -0,0 +1,76 @@
+#pragma once
+
+#include "ProductPool.h"
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+
+class Warehouse;
+
+
+/**
+ * Tracks the products held in all warehouses.
+ *
+ * Keeps colony wide product counts, the warehouses holding each product
+ * and warehouses ordered by free space so that storing, pulling and
+ * counting products don't need to visit every warehouse.
+ *
+ * \note	Call update() after changing the products of a warehouse
+ *			directly instead of through the inventory.
+ */
+class WarehouseInventory
+{
+public:
+	void insert(Warehouse& warehouse);
+	void remove(Warehouse& warehouse);
+	void clear();
+
+	void update(Warehouse& warehouse);
+
+	int count(ProductType type) const;
+	Warehouse* findStorage(ProductType type, int count) const;
+
+	bool store(ProductType type, int count);
+	int pull(ProductType type, int count);
+
+	bool empty() const { return mRecords.empty(); }
+	int meanAvailableStoragePercent() const;
+
+private:
+	struct Record
+	{
+		std::size_t order; /**< Position in the order warehouses were added. */
+		ProductPool::ProductTypeCount products;
+		int availableStorage;
+		int availableStoragePercent;
+	};
+
+	struct FreeStorageEntry
+	{
+		int availableStorage;
+		std::size_t order;
+		Warehouse* warehouse;
+
+		bool operator<(const FreeStorageEntry& other) const
+		{
+			// Most available storage first, ties in the order warehouses were added
+			if (availableStorage != other.availableStorage) { return availableStorage > other.availableStorage; }
+			return order < other.order;
+		}
+	};
+
+	using StockTable = std::map<std::size_t, Warehouse*>; /**< Warehouses holding a product, keyed by Record::order. */
+
+	void track(Warehouse& warehouse, Record& record, int sign);
+
+	std::unordered_map<const Warehouse*, Record> mRecords;
+	std::set<FreeStorageEntry> mFreeStorage;
+	std::array<StockTable, ProductType::PRODUCT_COUNT> mStock;
+	ProductPool::ProductTypeCount mTotals{};
+	int mAvailableStoragePercentTotal{0};
+	std::size_t mNextOrder{0};
+};
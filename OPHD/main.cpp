@@ -2,6 +2,9 @@
 #include "Common.h"
 #include "Constants/Strings.h"
 #include "Constants/Numbers.h"
+#include "DrawBenchmark.h"
+#include "RendererCounting.h"
+#include "RendererRecording.h"
 #include "WindowEventWrapper.h"
 
 #include "States/GameState.h"
@@ -26,6 +29,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <string>
 
 
 using namespace NAS2D;
@@ -61,6 +65,9 @@ int main(int argc, char *argv[])
 
 	std::cout << "OutpostHD " << constants::Version << std::endl << std::endl;
 
+	// ophd --benchmark <savegame> [frames]: draws a savegame with the recording renderer
+	const bool isBenchmark = argc > 2 && std::string{argv[1]} == "--benchmark";
+
 	try
 	{
 		auto& filesystem = Utility<Filesystem>::init<Filesystem>("OutpostHD", "LairWorks");
@@ -70,6 +77,7 @@ int main(int argc, char *argv[])
 		filesystem.mountReadWrite(filesystem.prefPath());
 
 		filesystem.makeDirectory(constants::SaveGamePath);
+		filesystem.makeDirectory(constants::TerrainCachePath);
 
 		Configuration& cf = Utility<Configuration>::init(
 			std::map<std::string, Dictionary>{
@@ -125,10 +133,18 @@ int main(int argc, char *argv[])
 
 		WindowEventWrapper windowEventWrapper;
 
-		std::cout << "Starting OpenGL Renderer:" << std::endl;
-		auto& renderer = Utility<Renderer>::init<RendererOpenGL>("OutpostHD");
+		if (isBenchmark)
+		{
+			std::cout << "Starting Recording Renderer." << std::endl;
+			Utility<Renderer>::init<RendererRecording>();
+		}
+		else
+		{
+			std::cout << "Starting OpenGL Renderer:" << std::endl;
+			dumpGraphicsInfo(Utility<Renderer>::init<RendererCounting<RendererOpenGL>>("OutpostHD"));
+		}
 
-		dumpGraphicsInfo(renderer);
+		auto& renderer = Utility<Renderer>::get();
 		std::cout << std::endl << "** GAME START **" << std::endl << std::endl;
 
 		renderer.minimumSize(constants::MinimumWindowSize);
@@ -147,13 +163,21 @@ int main(int argc, char *argv[])
 			renderer.maximize();
 		}
 
-		trackMars = std::make_unique<NAS2D::Music>("music/mars.ogg");
-		Utility<Mixer>::get().playMusic(*trackMars);
+		if (!isBenchmark)
+		{
+			trackMars = std::make_unique<NAS2D::Music>("music/mars.ogg");
+			Utility<Mixer>::get().playMusic(*trackMars);
+		}
 
 		StateManager stateManager;
 		stateManager.forceStopAudio(false);
 
-		if (argc > 1)
+		if (isBenchmark)
+		{
+			const auto frameCount = (argc > 3) ? std::stoi(argv[3]) : 600;
+			runDrawBenchmark(stateManager, static_cast<RendererRecording&>(renderer), constants::SaveGamePath + argv[2] + ".xml", frameCount);
+		}
+		else if (argc > 1)
 		{
 			std::string filename = constants::SaveGamePath + argv[1] + ".xml";
 			if (!filesystem.exists(filename))
@@ -182,7 +206,7 @@ int main(int argc, char *argv[])
 		}
 
 		// Game Loop
-		while (stateManager.update())
+		while (!isBenchmark && stateManager.update())
 		{
 			renderer.update();
 		}
@@ -32,8 +32,6 @@ ListBoxBase::~ListBoxBase()
 	eventHandler.mouseWheel().disconnect({this, &ListBoxBase::onMouseWheel});
 	eventHandler.mouseButtonDown().disconnect({this, &ListBoxBase::onMouseDown});
 	eventHandler.mouseMotion().disconnect({this, &ListBoxBase::onMouseMove});
-
-	for (auto item : mItems) { delete item; }
 }
 
 
@@ -42,7 +40,7 @@ ListBoxBase::~ListBoxBase()
  */
 bool ListBoxBase::isEmpty() const
 {
-	return mItems.empty();
+	return mItemCount == 0;
 }
 
 
@@ -51,7 +49,7 @@ bool ListBoxBase::isEmpty() const
  */
 std::size_t ListBoxBase::count() const
 {
-	return mItems.size();
+	return mItemCount;
 }
 
 
@@ -61,6 +59,16 @@ void ListBoxBase::onVisibilityChange(bool)
 }
 
 
+/**
+ * Called by derived types after items are added or removed.
+ */
+void ListBoxBase::itemsChanged(std::size_t itemCount)
+{
+	mItemCount = itemCount;
+	updateScrollLayout();
+}
+
+
 /**
  * Updates values required for properly displaying list items.
  */
@@ -68,11 +76,11 @@ void ListBoxBase::updateScrollLayout()
 {
 	mItemWidth = mRect.size.x;
 
-	if ((mItemHeight * static_cast<int>(mItems.size())) > mRect.size.y)
+	if ((mItemHeight * static_cast<int>(mItemCount)) > mRect.size.y)
 	{
 		mScrollBar.position({rect().position.x + mRect.size.x - 14, mRect.position.y});
 		mScrollBar.size({14, mRect.size.y});
-		mScrollBar.max(static_cast<ScrollBar::ValueType>(mItemHeight * static_cast<int>(mItems.size()) - mRect.size.y));
+		mScrollBar.max(static_cast<ScrollBar::ValueType>(mItemHeight * static_cast<int>(mItemCount) - mRect.size.y));
 		mScrollOffsetInPixels = static_cast<unsigned int>(mScrollBar.value());
 		mItemWidth -= mScrollBar.size().x;
 		mScrollBar.visible(true);
@@ -110,7 +118,7 @@ void ListBoxBase::onMouseDown(NAS2D::EventHandler::MouseButton button, NAS2D::Po
 	// A few basic checks
 	if (!rect().contains(position) || mHighlightIndex == NoSelection) { return; }
 	if (mScrollBar.visible() && mScrollBar.rect().contains(position)) { return; }
-	if (mHighlightIndex >= mItems.size()) { return; }
+	if (mHighlightIndex >= mItemCount) { return; }
 
 	setSelection(mHighlightIndex);
 }
@@ -138,7 +146,7 @@ void ListBoxBase::onMouseMove(NAS2D::Point<int> position, NAS2D::Vector<int> /*r
 
 	mHighlightIndex = (static_cast<unsigned int>(position.y - positionY()) + mScrollOffsetInPixels) / static_cast<unsigned int>(mItemHeight);
 
-	if (mHighlightIndex >= mItems.size())
+	if (mHighlightIndex >= mItemCount)
 	{
 		mHighlightIndex = NoSelection;
 	}
@@ -170,8 +178,8 @@ void ListBoxBase::onSlideChange(ScrollBar::ValueType /*newPosition*/)
  */
 void ListBoxBase::clear()
 {
-	for (auto item : mItems) { delete item; }
-	mItems.clear();
+	clearItems();
+	mItemCount = 0;
 	mSelectedIndex = NoSelection;
 	mHighlightIndex = NoSelection;
 	updateScrollLayout();
@@ -209,7 +217,7 @@ const ListBoxBase::ListBoxItem& ListBoxBase::selected() const
 		throw std::runtime_error("ListBox has no selected item");
 	}
 
-	return *mItems[mSelectedIndex];
+	return item(mSelectedIndex);
 }
 
 
@@ -220,7 +228,7 @@ const ListBoxBase::ListBoxItem& ListBoxBase::selected() const
  */
 void ListBoxBase::setSelection(std::size_t selection)
 {
-	mSelectedIndex = (selection < mItems.size()) ? selection : NoSelection;
+	mSelectedIndex = (selection < mItemCount) ? selection : NoSelection;
 	mSelectionChanged();
 }
 
@@ -245,6 +253,37 @@ void ListBoxBase::item_height(int h)
 }
 
 
+/**
+ * Index of the first item that is at least partly inside the list area.
+ */
+std::size_t ListBoxBase::firstVisibleIndex(unsigned int scrollOffset, unsigned int itemHeight, std::size_t itemCount)
+{
+	return std::min(static_cast<std::size_t>(scrollOffset / itemHeight), itemCount);
+}
+
+
+/**
+ * One past the index of the last item that is at least partly inside the list area.
+ */
+std::size_t ListBoxBase::endVisibleIndex(unsigned int scrollOffset, unsigned int viewHeight, unsigned int itemHeight, std::size_t itemCount)
+{
+	const auto visibleBottom = scrollOffset + viewHeight;
+	return std::min(static_cast<std::size_t>((visibleBottom + itemHeight - 1) / itemHeight), itemCount);
+}
+
+
+std::size_t ListBoxBase::firstVisibleIndex() const
+{
+	return firstVisibleIndex(mScrollOffsetInPixels, static_cast<unsigned int>(mItemHeight), mItemCount);
+}
+
+
+std::size_t ListBoxBase::endVisibleIndex() const
+{
+	return endVisibleIndex(mScrollOffsetInPixels, static_cast<unsigned int>(mRect.size.y), static_cast<unsigned int>(mItemHeight), mItemCount);
+}
+
+
 /**
  * Draws the ListBox
  */
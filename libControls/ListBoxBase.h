@@ -13,6 +13,7 @@
 #include <vector>
 #include <cstddef>
 #include <limits>
+#include <utility>
 
 
 /**
@@ -68,15 +69,19 @@ public:
 	void update() override = 0;
 	void draw() const override;
 
+	static std::size_t firstVisibleIndex(unsigned int scrollOffset, unsigned int itemHeight, std::size_t itemCount);
+	static std::size_t endVisibleIndex(unsigned int scrollOffset, unsigned int viewHeight, unsigned int itemHeight, std::size_t itemCount);
+
 protected:
-	template <typename ItemType, typename... Args>
-	void add(Args&&... args) {
-		mItems.emplace_back(new ItemType{std::forward<Args>(args)...});
-		updateScrollLayout();
-	}
+	virtual const ListBoxItem& item(std::size_t index) const = 0;
+	virtual void clearItems() = 0;
 
+	void itemsChanged(std::size_t itemCount);
 	void updateScrollLayout();
 
+	std::size_t firstVisibleIndex() const;
+	std::size_t endVisibleIndex() const;
+
 	unsigned int item_width() const { return static_cast<unsigned int>(mItemWidth); }
 	unsigned int item_height() const { return static_cast<unsigned int>(mItemHeight); }
 	void item_height(int);
@@ -85,9 +90,6 @@ protected:
 
 	void onVisibilityChange(bool) override;
 
-
-	std::vector<ListBoxItem*> mItems; /**< List of Items. Pointers used for polymorphism. */
-
 private:
 	void onSlideChange(ScrollBar::ValueType newPosition);
 
@@ -98,6 +100,7 @@ private:
 	void onResize() override;
 
 
+	std::size_t mItemCount = 0;
 	std::size_t mHighlightIndex = NoSelection;
 	std::size_t mSelectedIndex = NoSelection;
 	unsigned int mScrollOffsetInPixels = 0;
@@ -112,3 +115,27 @@ private:
 	SelectionChangeSignal mSelectionChanged; /**< Signal for selection changed callback. */
 	ScrollBar mScrollBar; /**< ScrollBar control. */
 };
+
+
+/**
+ * ListBoxBase that stores items of a single type by value.
+ *
+ * Items are kept in contiguous storage so large lists don't need an
+ * allocation per item.
+ */
+template <typename ItemType>
+class ListBoxBaseOf : public ListBoxBase
+{
+protected:
+	template <typename... Args>
+	ItemType& add(Args&&... args) {
+		auto& newItem = mItems.emplace_back(std::forward<Args>(args)...);
+		itemsChanged(mItems.size());
+		return newItem;
+	}
+
+	const ItemType& item(std::size_t index) const override { return mItems[index]; }
+	void clearItems() override { mItems.clear(); }
+
+	std::vector<ItemType> mItems; /**< List of Items. */
+};
@@ -1,9 +1,10 @@
 #include "TextArea.h"
 
-#include <NAS2D/StringUtils.h>
 #include <NAS2D/Utility.h>
 #include <NAS2D/Renderer/Renderer.h>
 
+#include <algorithm>
+
 
 TextArea::TextArea() :
 	mFont{&getDefaultFont()}
@@ -17,67 +18,136 @@ TextArea::TextArea(const NAS2D::Font& font) :
 }
 
 
-void TextArea::processString()
+/**
+ * Width of a space separated token including the space that follows it.
+ *
+ * Widths measured by the previous wrap are reused. Every token of the
+ * current wrap is recorded in \c wrappedTokenWidths.
+ */
+int TextArea::tokenWidth(std::string_view token, TokenWidths& wrappedTokenWidths) const
 {
-	mFormattedList.clear();
+	const auto wrappedIt = wrappedTokenWidths.find(token);
+	if (wrappedIt != wrappedTokenWidths.end()) { return wrappedIt->second; }
+
+	const auto it = mTokenWidths.find(token);
+	const auto width = (it != mTokenWidths.end()) ? it->second : mFont->width(std::string{token} + " ");
+	wrappedTokenWidths.emplace(std::string{token}, width);
+	return width;
+}
+
+
+/**
+ * Wraps the text into lines that fit the width of the TextArea.
+ *
+ * Lines before the paragraph containing \c changedOffset are kept
+ * as they are. Everything from the start of that paragraph onward
+ * is wrapped again.
+ *
+ * \param	changedOffset	Offset of the first character that differs from the previously wrapped text.
+ */
+void TextArea::wrapText(std::size_t changedOffset)
+{
+	mWrapWidth = mRect.size.x;
+
+	if (mRect.size.x < 10 || !mFont || text().empty())
+	{
+		mLines.clear();
+		mWrappedText.clear();
+		mTokenWidths.clear();
+		return;
+	}
 
-	if (mRect.size.x < 10 || !mFont || text().empty()) { return; }
+	const auto paragraph = std::find_if(mLines.rbegin(), mLines.rend(), [changedOffset](const Line& line) {
+		return line.paragraphStart && line.begin <= changedOffset;
+	});
+
+	std::size_t position = 0;
+	if (paragraph != mLines.rend())
+	{
+		position = paragraph->begin;
+		mLines.erase(std::prev(paragraph.base()), mLines.end());
+	}
+	else
+	{
+		mLines.clear();
+	}
 
-	const auto tokenList = NAS2D::split(text(), ' ');
+	const std::string_view fullText{text()};
+	Line line{position, position, true};
+	int lineWidth = 0;
+	bool lineEmpty = true;
+	TokenWidths wrappedTokenWidths;
 
-	std::size_t i = 0;
-	int w = 0;
-	while (i < tokenList.size())
+	while (position <= fullText.size())
 	{
-		std::string line;
-		while (w < mRect.size.x && i < tokenList.size())
+		const auto tokenEnd = std::min(fullText.find(' ', position), fullText.size());
+		const auto token = fullText.substr(position, tokenEnd - position);
+
+		if (token == "\n")
 		{
-			int tokenWidth = mFont->width(tokenList[i] + " ");
-			w += tokenWidth;
-			if (w >= mRect.size.x)
-			{
-				/**
-				 * \todo	In some edge cases where the width of the TextArea is too
-				 *			narrow for a single word/token, this will result in an infinite
-				 *			loop. This edge case will need to be resolved either by splitting
-				 *			the token that's too wide or by simply rendering it as is.
-				 */
-				//++i;
-				break;
-			}
+			mLines.push_back(line);
+			line = {tokenEnd + 1, tokenEnd + 1, true};
+			lineWidth = 0;
+			lineEmpty = true;
+		}
+		else
+		{
+			const auto width = tokenWidth(token, wrappedTokenWidths);
 
-			if (tokenList[i] == "\n")
+			// A token wider than the TextArea gets a line to itself
+			if (!lineEmpty && lineWidth + width >= mRect.size.x)
 			{
-				++i;
-				break;
+				mLines.push_back(line);
+				line = {position, position, false};
+				lineWidth = 0;
 			}
-			line += (tokenList[i] + " ");
-			++i;
+
+			line.end = tokenEnd;
+			lineWidth += width;
+			lineEmpty = false;
 		}
-		w = 0;
-		mFormattedList.push_back(line);
+
+		position = tokenEnd + 1;
 	}
 
-	mNumLines = static_cast<std::size_t>(mRect.size.y / mFont->height());
+	if (!lineEmpty) { mLines.push_back(line); }
+
+	mWrappedText = text();
+
+	// Only keep widths of tokens that were just wrapped so the cache stays bounded
+	mTokenWidths.swap(wrappedTokenWidths);
 }
 
 
 void TextArea::onResize()
 {
 	Control::onResize();
-	processString();
+
+	if (mFont) { mNumLines = static_cast<std::size_t>(mRect.size.y / mFont->height()); }
+	if (mRect.size.x != mWrapWidth)
+	{
+		mLines.clear();
+		wrapText(0);
+	}
 }
 
 
 void TextArea::onTextChange()
 {
-	processString();
+	const auto mismatch = std::mismatch(mWrappedText.begin(), mWrappedText.end(), mText.begin(), mText.end());
+	if (mismatch.first == mWrappedText.end() && mismatch.second == mText.end() && !mLines.empty()) { return; }
+
+	wrapText(static_cast<std::size_t>(mismatch.second - mText.begin()));
 }
 
 
 void TextArea::onFontChange()
 {
-	processString();
+	mTokenWidths.clear();
+	if (mFont) { mNumLines = static_cast<std::size_t>(mRect.size.y / mFont->height()); }
+
+	mLines.clear();
+	wrapText(0);
 }
 
 
@@ -95,10 +165,12 @@ void TextArea::draw() const
 
 	if (!mFont) { return; }
 
+	const std::string_view fullText{text()};
 	auto textPosition = mRect.position;
-	for (std::size_t i = 0; i < mFormattedList.size() && i < mNumLines; ++i)
+	for (std::size_t i = 0; i < mLines.size() && i < mNumLines; ++i)
 	{
-		renderer.drawText(*mFont, mFormattedList[i], textPosition, mTextColor);
+		const auto& line = mLines[i];
+		renderer.drawText(*mFont, fullText.substr(line.begin, line.end - line.begin), textPosition, mTextColor);
 		textPosition.y += mFont->height();
 	}
 }
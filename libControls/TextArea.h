@@ -5,7 +5,12 @@
 #include <NAS2D/Renderer/Color.h>
 #include <NAS2D/Resource/Font.h>
 
+#include <cstddef>
+#include <functional>
+#include <map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 
 class TextArea : public TextControl
@@ -19,18 +24,32 @@ public:
 	void update() override;
 
 private:
-	using StringList = std::vector<std::string>;
+	/**
+	 * A wrapped line stored as offsets into the text.
+	 */
+	struct Line
+	{
+		std::size_t begin;
+		std::size_t end;
+		bool paragraphStart; /**< First line of the text or the first line after a forced break. */
+	};
+
+	using TokenWidths = std::map<std::string, int, std::less<>>;
 
 	void onResize() override;
 	void onTextChange() override;
 	virtual void onFontChange();
 
 	void draw() const override;
-	void processString();
+	void wrapText(std::size_t changedOffset);
+	int tokenWidth(std::string_view token, TokenWidths& wrappedTokenWidths) const;
 
 	std::size_t mNumLines = 0;
+	int mWrapWidth = 0; /**< Width the current lines were wrapped to. */
 
-	StringList mFormattedList;
+	std::vector<Line> mLines;
+	std::string mWrappedText; /**< Text the current lines were wrapped from. */
+	TokenWidths mTokenWidths; /**< Width of each token plus its trailing space, for the tokens of the last wrap. */
 
 	NAS2D::Color mTextColor = NAS2D::Color::White;
 
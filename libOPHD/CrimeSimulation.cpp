@@ -0,0 +1,49 @@
+#include "CrimeSimulation.h"
+
+#include <algorithm>
+
+
+void CrimeBatch::resize(std::size_t count)
+{
+	crimeRates.resize(count);
+	isProtected.resize(count);
+	commitsCrime.resize(count);
+}
+
+
+/**
+ * Advances crime rates for a batch of structures and draws which of them
+ * commit a crime this turn.
+ *
+ * Crime rates fall by 1 for protected structures and rise by 1 otherwise,
+ * staying within 0 - 100. A crime occurs when the crime rate scaled by
+ * \c chanceCrimeOccurs plus a random value from 0 - 1000 exceeds 1000.
+ *
+ * \param	chanceCrimeOccurs	Difficulty multiplier. Higher values make crime more likely.
+ * \param	random				Source of random values, one is drawn per structure.
+ *
+ * \return	Mean crime rate of the batch, or 0 if the batch is empty.
+ */
+int updateCrimeBatch(CrimeBatch& batch, float chanceCrimeOccurs, const CounterRandom& random)
+{
+	const auto count = batch.size();
+	if (count == 0) { return 0; }
+
+	auto* crimeRates = batch.crimeRates.data();
+	const auto* isProtected = batch.isProtected.data();
+	auto* commitsCrime = batch.commitsCrime.data();
+
+	std::int64_t accumulatedCrime = 0;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const auto crimeRate = std::clamp(crimeRates[i] + (isProtected[i] ? -1 : 1), 0, 100);
+		crimeRates[i] = crimeRate;
+
+		const auto roll = static_cast<int>(random.uniform(i, 1001));
+		commitsCrime[i] = static_cast<int>(static_cast<float>(crimeRate) * chanceCrimeOccurs) + roll > 1000;
+
+		accumulatedCrime += crimeRate;
+	}
+
+	return static_cast<int>(accumulatedCrime / static_cast<std::int64_t>(count));
+}
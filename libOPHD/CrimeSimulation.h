@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * Counter based random number generator.
+ *
+ * Each value is a hash of a seed and a counter rather than the next step
+ * of a sequence, so values can be drawn in any order, or many at once,
+ * and still give the same results for the same seed.
+ */
+class CounterRandom
+{
+public:
+	explicit constexpr CounterRandom(std::uint64_t seed) : mSeed{seed} {}
+
+	constexpr std::uint64_t operator()(std::uint64_t counter) const
+	{
+		// SplitMix64 finalizer
+		auto value = mSeed + (counter + 1) * 0x9E3779B97F4A7C15ull;
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+		return value ^ (value >> 31);
+	}
+
+	/**
+	 * Uniformly distributed value in the range [0, bound).
+	 */
+	constexpr std::uint32_t uniform(std::uint64_t counter, std::uint32_t bound) const
+	{
+		return static_cast<std::uint32_t>(((*this)(counter) >> 32) * bound >> 32);
+	}
+
+private:
+	std::uint64_t mSeed;
+};
+
+
+/**
+ * Crime state of a set of structures stored as parallel arrays.
+ */
+struct CrimeBatch
+{
+	std::vector<int> crimeRates;
+	std::vector<std::uint8_t> isProtected;
+	std::vector<std::uint8_t> commitsCrime; /**< Output, set for each structure where a crime occurs. */
+
+	void resize(std::size_t count);
+	std::size_t size() const { return crimeRates.size(); }
+};
+
+
+int updateCrimeBatch(CrimeBatch& batch, float chanceCrimeOccurs, const CounterRandom& random);
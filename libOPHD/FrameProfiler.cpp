@@ -0,0 +1,163 @@
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+
+namespace
+{
+	const std::array<std::string, FrameProfiler::PhaseCount> PhaseNames
+	{
+		"Map update",
+		"Map draw",
+		"UI draw",
+		"Window stack"
+	};
+}
+
+
+FrameProfiler::Scope::Scope(FrameProfiler& profiler, Phase phase) :
+	mProfiler{profiler},
+	mPhase{phase},
+	mStart{Clock::now()}
+{}
+
+
+FrameProfiler::Scope::~Scope()
+{
+	mProfiler.mCurrent.phaseTimes[static_cast<std::size_t>(mPhase)] += milliseconds(Clock::now() - mStart);
+}
+
+
+FrameProfiler::FrameProfiler(std::size_t historySize, AllocationCounter allocationCounter) :
+	mHistorySize{historySize},
+	mAllocationCounter{std::move(allocationCounter)}
+{
+	if (historySize == 0)
+	{
+		throw std::runtime_error("FrameProfiler(): History size must be positive");
+	}
+	mHistory.reserve(historySize);
+}
+
+
+void FrameProfiler::beginFrame()
+{
+	mCurrent = FrameSample{};
+	mFrameStart = Clock::now();
+	mFrameStartAllocations = allocationCount();
+}
+
+
+/**
+ * Completes the current frame and adds it to the history.
+ *
+ * \param	drawCalls		Draw calls made during the frame.
+ * \param	textureBinds	Texture changes made during the frame.
+ */
+void FrameProfiler::endFrame(std::size_t drawCalls, std::size_t textureBinds)
+{
+	mCurrent.frameTime = milliseconds(Clock::now() - mFrameStart);
+	mCurrent.drawCalls = drawCalls;
+	mCurrent.textureBinds = textureBinds;
+	mCurrent.allocations = allocationCount() - mFrameStartAllocations;
+
+	recordFrame(mCurrent);
+}
+
+
+/**
+ * Adds a completed frame to the history and the log.
+ */
+void FrameProfiler::recordFrame(const FrameSample& sample)
+{
+	if (mHistory.size() < mHistorySize) { mHistory.push_back(sample); }
+	else { mHistory[mNextSlot] = sample; }
+	mNextSlot = (mNextSlot + 1) % mHistorySize;
+
+	if (mLog.is_open())
+	{
+		mLog << sample.frameTime;
+		for (const auto phaseTime : sample.phaseTimes) { mLog << ',' << phaseTime; }
+		mLog << ',' << sample.drawCalls << ',' << sample.textureBinds << ',' << sample.allocations << '\n';
+	}
+}
+
+
+/**
+ * Most recently completed frame.
+ *
+ * \throws	std::runtime_error if no frame has completed.
+ */
+const FrameProfiler::FrameSample& FrameProfiler::lastFrame() const
+{
+	if (mHistory.empty())
+	{
+		throw std::runtime_error("FrameProfiler::lastFrame(): No frames recorded");
+	}
+	return mHistory[(mNextSlot + mHistorySize - 1) % mHistorySize];
+}
+
+
+/**
+ * Frame time in milliseconds below which \c percentile percent of recent
+ * frames fall, using the nearest rank. Returns 0 if no frame has completed.
+ */
+double FrameProfiler::frameTimePercentile(double percentile) const
+{
+	if (mHistory.empty()) { return 0.0; }
+
+	std::vector<double> frameTimes;
+	frameTimes.reserve(mHistory.size());
+	for (const auto& sample : mHistory) { frameTimes.push_back(sample.frameTime); }
+
+	const auto rank = static_cast<std::size_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(frameTimes.size())));
+	const auto index = std::max(rank, std::size_t{1}) - 1;
+	std::nth_element(frameTimes.begin(), frameTimes.begin() + static_cast<std::ptrdiff_t>(index), frameTimes.end());
+	return frameTimes[index];
+}
+
+
+/**
+ * Writes a CSV row for each completed frame to \c filename until stopLog()
+ * is called. Times are in milliseconds.
+ */
+void FrameProfiler::startLog(const std::string& filename)
+{
+	mLog.close();
+	mLog.open(filename);
+	if (!mLog)
+	{
+		throw std::runtime_error("FrameProfiler::startLog(): Unable to open " + filename);
+	}
+
+	mLog << "Frame ms";
+	for (const auto& name : PhaseNames) { mLog << ',' << name << " ms"; }
+	mLog << ",Draw calls,Texture binds,Allocations\n";
+}
+
+
+void FrameProfiler::stopLog()
+{
+	mLog.close();
+}
+
+
+const std::string& FrameProfiler::phaseName(Phase phase)
+{
+	return PhaseNames[static_cast<std::size_t>(phase)];
+}
+
+
+double FrameProfiler::milliseconds(Clock::duration duration)
+{
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+
+std::size_t FrameProfiler::allocationCount() const
+{
+	return mAllocationCounter ? mAllocationCounter() : 0;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+
+/**
+ * Collects per frame timing and counters over a window of recent frames.
+ *
+ * Frames are bracketed by beginFrame() and endFrame(). Time spent in the
+ * phases of a frame is measured with Scope objects.
+ *
+ * Allocations are only counted when a counter function is given. It
+ * returns the total number of allocations made so far.
+ */
+class FrameProfiler
+{
+public:
+	enum class Phase
+	{
+		MapUpdate,
+		MapDraw,
+		UiDraw, /**< Includes WindowStack. */
+		WindowStack,
+
+		Count
+	};
+
+	static constexpr std::size_t PhaseCount = static_cast<std::size_t>(Phase::Count);
+
+	struct FrameSample
+	{
+		double frameTime{0.0}; /**< Milliseconds. */
+		std::array<double, PhaseCount> phaseTimes{}; /**< Milliseconds. */
+		std::size_t drawCalls{0};
+		std::size_t textureBinds{0};
+		std::size_t allocations{0};
+	};
+
+	/**
+	 * Adds the time between its construction and destruction to a phase.
+	 */
+	class Scope
+	{
+	public:
+		Scope(FrameProfiler& profiler, Phase phase);
+		~Scope();
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		FrameProfiler& mProfiler;
+		Phase mPhase;
+		std::chrono::steady_clock::time_point mStart;
+	};
+
+	using AllocationCounter = std::function<std::size_t()>;
+
+	explicit FrameProfiler(std::size_t historySize = 240, AllocationCounter allocationCounter = {});
+
+	void beginFrame();
+	void endFrame(std::size_t drawCalls, std::size_t textureBinds);
+	void recordFrame(const FrameSample& sample);
+
+	std::size_t frameCount() const { return mHistory.size(); }
+	const FrameSample& lastFrame() const;
+	double frameTimePercentile(double percentile) const;
+
+	void startLog(const std::string& filename);
+	void stopLog();
+	bool logging() const { return mLog.is_open(); }
+
+	static const std::string& phaseName(Phase phase);
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	static double milliseconds(Clock::duration duration);
+
+	std::size_t allocationCount() const;
+
+	std::size_t mHistorySize;
+	AllocationCounter mAllocationCounter;
+	std::vector<FrameSample> mHistory; /**< Ring buffer of completed frames. */
+	std::size_t mNextSlot{0};
+
+	FrameSample mCurrent;
+	Clock::time_point mFrameStart;
+	std::size_t mFrameStartAllocations{0};
+
+	std::ofstream mLog;
+};
@@ -1,12 +1,9 @@
 #include "Population.h"
 #include "Morale.h"
-
-#include <libOPHD/RandomNumberGenerator.h>
+#include "PopulationSampling.h"
 
 #include <algorithm>
 #include <array>
-#include <stdexcept>
-#include <string>
 
 
 namespace
@@ -78,22 +75,9 @@ void Population::spawnPopulation(int morale, int residences, int nurseries, int
 	mPopulation.child -= newRoles.student;
 	mPopulation.student -= (newRoles.worker + newRoles.scientist);
 
-	if (newRoles.retiree > mPopulation.employable())
-	{
-		throw std::runtime_error("Retiring more people than employable population: Retiring: " + std::to_string(newRoles.retiree));
-	}
-
-	for (int toRetire = newRoles.retiree; toRetire > 0;)
-	{
-		/** Workers retire earlier than scientists. */
-		auto& retireRole = randomNumber.generate(0, 100) <= 45 ?
-			mPopulation.scientist : mPopulation.worker;
-		if (retireRole > 0)
-		{
-			--retireRole;
-			--toRetire;
-		}
-	}
+	const auto retiringScientists = drawRetiringScientists(mPopulation, newRoles.retiree);
+	mPopulation.scientist -= retiringScientists;
+	mPopulation.worker -= newRoles.retiree - retiringScientists;
 }
 
 
@@ -164,14 +148,7 @@ int Population::consumeFood(int food)
 	const int populationToKill = std::clamp(static_cast<int>(static_cast<float>(populationUnfed) * mStarveRate), minKill, mPopulation.size());
 	mDeathCount += populationToKill;
 
-	for (int i = populationToKill; i > 0; mStarveRoleIndex = (mStarveRoleIndex + 1) % 5)
-	{
-		if (mPopulation[mStarveRoleIndex] > 0)
-		{
-			--mPopulation[mStarveRoleIndex];
-			--i;
-		}
-	}
+	killEvenly(mPopulation, populationToKill, mStarveRoleIndex);
 
 	// Round up food consumption for remaining people
 	return (mPopulation.size() + (PopulationPerFood - 1)) / PopulationPerFood;
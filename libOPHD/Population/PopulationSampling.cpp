@@ -0,0 +1,96 @@
+#include "PopulationSampling.h"
+#include "PopulationTable.h"
+
+#include "../RandomNumberGenerator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+
+namespace
+{
+	const auto roleCount = sizeof(PopulationTable) / sizeof(int);
+
+	/** Workers retire earlier than scientists. */
+	const double scientistRetireChance = 46.0 / 101.0;
+}
+
+
+/**
+ * Kills \c count people spread evenly across all roles that have any
+ * population left.
+ *
+ * People are taken one per non-empty role in turn, starting at \c nextRole.
+ * Full passes over the non-empty roles are applied in bulk so the cost does
+ * not depend on \c count.
+ *
+ * \param	nextRole	Role to take the next person from. Updated so later
+ *						calls continue the rotation.
+ */
+void killEvenly(PopulationTable& population, int count, std::size_t& nextRole)
+{
+	if (count > population.size())
+	{
+		throw std::runtime_error("Killing more people than population: Killing: " + std::to_string(count));
+	}
+
+	while (count > 0)
+	{
+		int nonEmptyRoles = 0;
+		int smallestRole = population.size();
+		for (std::size_t role = 0; role < roleCount; ++role)
+		{
+			if (population[role] > 0)
+			{
+				++nonEmptyRoles;
+				smallestRole = std::min(smallestRole, population[role]);
+			}
+		}
+
+		// Leave the last person to the loop below so it ends on the same role
+		const auto fullPasses = std::min((count - 1) / nonEmptyRoles, smallestRole);
+		if (fullPasses == 0) { break; }
+
+		for (std::size_t role = 0; role < roleCount; ++role)
+		{
+			if (population[role] > 0)
+			{
+				population[role] -= fullPasses;
+			}
+		}
+		count -= fullPasses * nonEmptyRoles;
+	}
+
+	// No more people left to kill than there are non-empty roles
+	for (; count > 0; nextRole = (nextRole + 1) % roleCount)
+	{
+		if (population[nextRole] > 0)
+		{
+			--population[nextRole];
+			--count;
+		}
+	}
+}
+
+
+/**
+ * Picks how many of \c retirees are scientists with the rest being workers.
+ *
+ * Each retiree is a scientist with a fixed chance, as long as there are
+ * scientists left, so the count is a binomial sample clamped to the
+ * available scientists and workers.
+ */
+int drawRetiringScientists(const PopulationTable& population, int retirees)
+{
+	if (retirees > population.employable())
+	{
+		throw std::runtime_error("Retiring more people than employable population: Retiring: " + std::to_string(retirees));
+	}
+
+	return std::clamp(
+		randomNumber.binomial(retirees, scientistRetireChance),
+		retirees - population.worker,
+		population.scientist
+	);
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+
+
+struct PopulationTable;
+
+
+void killEvenly(PopulationTable& population, int count, std::size_t& nextRole);
+int drawRetiringScientists(const PopulationTable& population, int retirees);
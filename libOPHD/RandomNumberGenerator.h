@@ -35,6 +35,23 @@ public:
 		}
 	}
 
+	/**
+	 * Number of successes out of \c trials independent trials that each
+	 * succeed with the given \c probability.
+	 */
+	template <typename T>
+	std::enable_if_t<std::is_integral_v<T>, T>
+	binomial(T trials, double probability)
+	{
+		if (trials < 0 || probability < 0.0 || probability > 1.0)
+		{
+			throw std::runtime_error("When requesting a binomial sample, trials must not be negative and probability must be between 0 and 1.");
+		}
+
+		std::binomial_distribution<T> distribution(trials, probability);
+		return distribution(generator);
+	}
+
 private:
 	std::random_device randomDevice;
 	std::mt19937 generator;
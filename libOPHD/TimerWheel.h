@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+/**
+ * Hierarchical timer wheel of events keyed by tick.
+ *
+ * The first level has a slot for each of the next SlotCount ticks and each
+ * level after it has slots SlotCount times wider. Events far in the future
+ * wait in a wide slot and move down a level as their tick gets closer, so
+ * scheduling is O(1) and advancing only touches events that are due or
+ * moving down a level.
+ */
+template <typename Event>
+class TimerWheel
+{
+public:
+	static constexpr unsigned int SlotBits = 6;
+	static constexpr std::size_t SlotCount = std::size_t{1} << SlotBits;
+	static constexpr std::size_t LevelCount = 4;
+
+	explicit TimerWheel(std::uint64_t tick = 0) : mTick{tick} {}
+
+	/**
+	 * Last tick that was advanced to.
+	 */
+	std::uint64_t tick() const { return mTick; }
+
+	std::size_t size() const { return mSize; }
+	bool empty() const { return mSize == 0; }
+
+	void clear(std::uint64_t tick = 0)
+	{
+		for (auto& level : mLevels)
+		{
+			for (auto& slot : level) { slot.clear(); }
+		}
+		mOverflow.clear();
+		mSize = 0;
+		mTick = tick;
+	}
+
+	/**
+	 * Schedules an event to be dispatched when the wheel advances to \c tick.
+	 *
+	 * \note	Events scheduled at or before the current tick are dispatched
+	 *			on the next advance.
+	 */
+	void schedule(std::uint64_t tick, Event event)
+	{
+		place(std::max(tick, mTick + 1), std::move(event));
+		++mSize;
+	}
+
+	/**
+	 * Moves to the next tick and dispatches the events due on it.
+	 *
+	 * \param	dispatch	Called with each due event. It may schedule new events.
+	 */
+	template <typename Dispatch>
+	void advance(Dispatch dispatch)
+	{
+		++mTick;
+
+		if ((mTick & levelMask(LevelCount)) == 0)
+		{
+			cascade(mOverflow);
+		}
+
+		for (std::size_t level = LevelCount - 1; level > 0; --level)
+		{
+			if ((mTick & levelMask(level)) == 0)
+			{
+				cascade(mLevels[level][slotIndex(mTick, level)]);
+			}
+		}
+
+		auto due = std::move(mLevels[0][slotIndex(mTick, 0)]);
+		mLevels[0][slotIndex(mTick, 0)].clear();
+		mSize -= due.size();
+		for (auto& entry : due)
+		{
+			dispatch(entry.second);
+		}
+	}
+
+	/**
+	 * Removes every event that satisfies \c predicate.
+	 *
+	 * \note	Visits every scheduled event.
+	 */
+	template <typename Predicate>
+	void cancelIf(Predicate predicate)
+	{
+		const auto removeFrom = [this, &predicate](Slot& slot) {
+			const auto count = slot.size();
+			slot.erase(std::remove_if(slot.begin(), slot.end(), [&predicate](const auto& entry) { return predicate(entry.second); }), slot.end());
+			mSize -= count - slot.size();
+		};
+
+		for (auto& level : mLevels)
+		{
+			for (auto& slot : level) { removeFrom(slot); }
+		}
+		removeFrom(mOverflow);
+	}
+
+private:
+	using Slot = std::vector<std::pair<std::uint64_t, Event>>;
+
+	static constexpr std::uint64_t levelMask(std::size_t level)
+	{
+		return (std::uint64_t{1} << (SlotBits * level)) - 1;
+	}
+
+	static constexpr std::size_t slotIndex(std::uint64_t tick, std::size_t level)
+	{
+		return static_cast<std::size_t>(tick >> (SlotBits * level)) & (SlotCount - 1);
+	}
+
+	/**
+	 * Puts an event on the lowest level whose current span contains its tick.
+	 */
+	void place(std::uint64_t tick, Event event)
+	{
+		for (std::size_t level = 0; level < LevelCount; ++level)
+		{
+			const auto spanBits = SlotBits * (level + 1);
+			if ((tick >> spanBits) == (mTick >> spanBits))
+			{
+				mLevels[level][slotIndex(tick, level)].emplace_back(tick, std::move(event));
+				return;
+			}
+		}
+
+		mOverflow.emplace_back(tick, std::move(event));
+	}
+
+	void cascade(Slot& slot)
+	{
+		auto entries = std::move(slot);
+		slot.clear();
+		for (auto& entry : entries)
+		{
+			place(entry.first, std::move(entry.second));
+		}
+	}
+
+	std::uint64_t mTick;
+	std::size_t mSize{0};
+	std::array<std::array<Slot, SlotCount>, LevelCount> mLevels;
+	Slot mOverflow;
+};
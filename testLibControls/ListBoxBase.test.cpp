@@ -0,0 +1,46 @@
+#include <libControls/ListBoxBase.h>
+
+#include <gtest/gtest.h>
+
+
+TEST(ListBoxBase, VisibleIndicesAtTopOfList)
+{
+	EXPECT_EQ(0u, ListBoxBase::firstVisibleIndex(0, 10, 100));
+	EXPECT_EQ(3u, ListBoxBase::endVisibleIndex(0, 30, 10, 100));
+}
+
+
+TEST(ListBoxBase, VisibleIndicesWithScrollOffsetOnRowBoundary)
+{
+	EXPECT_EQ(2u, ListBoxBase::firstVisibleIndex(20, 10, 100));
+	EXPECT_EQ(5u, ListBoxBase::endVisibleIndex(20, 30, 10, 100));
+}
+
+
+TEST(ListBoxBase, VisibleIndicesWithScrollOffsetMidRow)
+{
+	// Rows 1 and 4 are only partly inside the list area
+	EXPECT_EQ(1u, ListBoxBase::firstVisibleIndex(15, 10, 100));
+	EXPECT_EQ(5u, ListBoxBase::endVisibleIndex(15, 30, 10, 100));
+}
+
+
+TEST(ListBoxBase, VisibleIndicesAtBottomOfList)
+{
+	EXPECT_EQ(7u, ListBoxBase::firstVisibleIndex(70, 10, 10));
+	EXPECT_EQ(10u, ListBoxBase::endVisibleIndex(70, 30, 10, 10));
+}
+
+
+TEST(ListBoxBase, VisibleIndicesForListShorterThanView)
+{
+	EXPECT_EQ(0u, ListBoxBase::firstVisibleIndex(0, 10, 3));
+	EXPECT_EQ(3u, ListBoxBase::endVisibleIndex(0, 100, 10, 3));
+}
+
+
+TEST(ListBoxBase, VisibleIndicesForEmptyList)
+{
+	EXPECT_EQ(0u, ListBoxBase::firstVisibleIndex(0, 10, 0));
+	EXPECT_EQ(0u, ListBoxBase::endVisibleIndex(0, 100, 10, 0));
+}
@@ -0,0 +1,95 @@
+#include <libOPHD/CrimeSimulation.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+
+
+namespace
+{
+	CrimeBatch makeBatch(std::size_t count, int crimeRate, bool isProtected)
+	{
+		CrimeBatch batch;
+		batch.resize(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			batch.crimeRates[i] = crimeRate;
+			batch.isProtected[i] = isProtected;
+		}
+		return batch;
+	}
+}
+
+
+TEST(CounterRandom, SameSeedAndCounterGivesSameValue)
+{
+	const CounterRandom random{42};
+	EXPECT_EQ(random(7), CounterRandom{42}(7));
+	EXPECT_NE(random(7), random(8));
+	EXPECT_NE(random(7), CounterRandom{43}(7));
+}
+
+
+TEST(CounterRandom, UniformStaysInBounds)
+{
+	const CounterRandom random{1234};
+	std::uint32_t lowest = 1001;
+	std::uint32_t highest = 0;
+	for (std::uint64_t i = 0; i < 100000; ++i)
+	{
+		const auto value = random.uniform(i, 1001);
+		lowest = std::min(lowest, value);
+		highest = std::max(highest, value);
+	}
+	EXPECT_EQ(0u, lowest);
+	EXPECT_EQ(1000u, highest);
+}
+
+
+TEST(CrimeSimulation, EmptyBatch)
+{
+	CrimeBatch batch;
+	EXPECT_EQ(0, updateCrimeBatch(batch, 1.0f, CounterRandom{0}));
+}
+
+
+TEST(CrimeSimulation, CrimeRatesChangeByProtection)
+{
+	CrimeBatch batch;
+	batch.resize(4);
+	batch.crimeRates = {0, 50, 50, 100};
+	batch.isProtected = {1, 1, 0, 0};
+
+	const auto meanCrimeRate = updateCrimeBatch(batch, 1.0f, CounterRandom{0});
+
+	EXPECT_EQ((std::vector<int>{0, 49, 51, 100}), batch.crimeRates);
+	EXPECT_EQ(50, meanCrimeRate);
+}
+
+
+TEST(CrimeSimulation, NoCrimeAtZeroCrimeRate)
+{
+	auto batch = makeBatch(10000, 0, true);
+	updateCrimeBatch(batch, 2.0f, CounterRandom{99});
+	for (const auto commitsCrime : batch.commitsCrime)
+	{
+		EXPECT_FALSE(commitsCrime);
+	}
+}
+
+
+TEST(CrimeSimulation, CrimeChanceFollowsDifficulty)
+{
+	// Crime Rate of 100% means crime occurs 10% of the time with a multiplier of 1.0
+	const std::size_t count = 100000;
+	auto batch = makeBatch(count, 100, false);
+	updateCrimeBatch(batch, 1.0f, CounterRandom{7});
+	const auto crimes = std::count(batch.commitsCrime.begin(), batch.commitsCrime.end(), 1);
+	EXPECT_NEAR(0.1, static_cast<double>(crimes) / count, 0.01);
+
+	batch = makeBatch(count, 100, false);
+	updateCrimeBatch(batch, 2.0f, CounterRandom{7});
+	const auto hardCrimes = std::count(batch.commitsCrime.begin(), batch.commitsCrime.end(), 1);
+	EXPECT_NEAR(0.2, static_cast<double>(hardCrimes) / count, 0.01);
+}
@@ -0,0 +1,80 @@
+#include <libOPHD/FrameProfiler.h>
+
+#include <gtest/gtest.h>
+
+
+namespace
+{
+	FrameProfiler::FrameSample frameTaking(double milliseconds)
+	{
+		FrameProfiler::FrameSample sample;
+		sample.frameTime = milliseconds;
+		return sample;
+	}
+}
+
+
+TEST(FrameProfiler, PercentilesUseNearestRank)
+{
+	FrameProfiler profiler{100};
+	for (int i = 100; i >= 1; --i)
+	{
+		profiler.recordFrame(frameTaking(i));
+	}
+
+	EXPECT_EQ(100u, profiler.frameCount());
+	EXPECT_DOUBLE_EQ(1.0, profiler.frameTimePercentile(0));
+	EXPECT_DOUBLE_EQ(50.0, profiler.frameTimePercentile(50));
+	EXPECT_DOUBLE_EQ(95.0, profiler.frameTimePercentile(95));
+	EXPECT_DOUBLE_EQ(99.0, profiler.frameTimePercentile(99));
+	EXPECT_DOUBLE_EQ(100.0, profiler.frameTimePercentile(100));
+}
+
+
+TEST(FrameProfiler, HistoryKeepsMostRecentFrames)
+{
+	FrameProfiler profiler{4};
+	EXPECT_DOUBLE_EQ(0.0, profiler.frameTimePercentile(50));
+	EXPECT_THROW(profiler.lastFrame(), std::runtime_error);
+
+	for (int i = 1; i <= 10; ++i)
+	{
+		profiler.recordFrame(frameTaking(i));
+	}
+
+	EXPECT_EQ(4u, profiler.frameCount());
+	EXPECT_DOUBLE_EQ(10.0, profiler.lastFrame().frameTime);
+	EXPECT_DOUBLE_EQ(7.0, profiler.frameTimePercentile(0));
+}
+
+
+TEST(FrameProfiler, EndFrameRecordsCountersAndPhases)
+{
+	std::size_t allocations = 5;
+	FrameProfiler profiler{240, [&allocations]() { return allocations; }};
+	profiler.beginFrame();
+	{
+		FrameProfiler::Scope scope{profiler, FrameProfiler::Phase::MapDraw};
+		allocations += 2;
+	}
+	profiler.endFrame(12, 3);
+
+	const auto& frame = profiler.lastFrame();
+	EXPECT_EQ(12u, frame.drawCalls);
+	EXPECT_EQ(3u, frame.textureBinds);
+	EXPECT_EQ(2u, frame.allocations);
+	EXPECT_GE(frame.phaseTimes[static_cast<std::size_t>(FrameProfiler::Phase::MapDraw)], 0.0);
+	EXPECT_DOUBLE_EQ(0.0, frame.phaseTimes[static_cast<std::size_t>(FrameProfiler::Phase::MapUpdate)]);
+	EXPECT_GE(frame.frameTime, frame.phaseTimes[static_cast<std::size_t>(FrameProfiler::Phase::MapDraw)]);
+}
+
+
+
+TEST(FrameProfiler, AllocationsAreZeroWithoutCounter)
+{
+	FrameProfiler profiler;
+	profiler.beginFrame();
+	profiler.endFrame(0, 0);
+
+	EXPECT_EQ(0u, profiler.lastFrame().allocations);
+}
@@ -0,0 +1,116 @@
+#include <libOPHD/Population/Population.h>
+#include <libOPHD/Population/PopulationSampling.h>
+#include <libOPHD/Population/PopulationTable.h>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+
+namespace
+{
+	// Kills one person at a time, as consumeFood did before killEvenly
+	void killOneAtATime(PopulationTable& population, int count, std::size_t& nextRole)
+	{
+		for (; count > 0; nextRole = (nextRole + 1) % 5)
+		{
+			if (population[nextRole] > 0)
+			{
+				--population[nextRole];
+				--count;
+			}
+		}
+	}
+
+
+	void expectSameTable(const PopulationTable& expected, const PopulationTable& actual)
+	{
+		for (std::size_t role = 0; role < 5; ++role)
+		{
+			EXPECT_EQ(expected[role], actual[role]) << "role " << role;
+		}
+	}
+}
+
+
+TEST(PopulationSampling, KillEvenlyMatchesOneAtATime)
+{
+	const PopulationTable tables[]{
+		{0, 0, 0, 0, 0},
+		{1, 0, 0, 0, 0},
+		{3, 0, 7, 0, 2},
+		{10, 10, 10, 10, 10},
+		{1, 2, 3, 4, 5},
+		{100000, 3, 0, 20000, 1},
+	};
+
+	for (const auto& table : tables)
+	{
+		for (int count = 0; count <= table.size(); count += 1 + table.size() / 50)
+		{
+			for (std::size_t startRole = 0; startRole < 5; ++startRole)
+			{
+				auto expected = table;
+				auto expectedNextRole = startRole;
+				killOneAtATime(expected, count, expectedNextRole);
+
+				auto actual = table;
+				auto actualNextRole = startRole;
+				killEvenly(actual, count, actualNextRole);
+
+				expectSameTable(expected, actual);
+				EXPECT_EQ(expectedNextRole, actualNextRole);
+			}
+		}
+	}
+}
+
+
+TEST(PopulationSampling, KillEvenlyRejectsMoreThanPopulation)
+{
+	PopulationTable population{1, 1, 1, 1, 1};
+	std::size_t nextRole = 0;
+	EXPECT_THROW(killEvenly(population, 6, nextRole), std::runtime_error);
+}
+
+
+TEST(PopulationSampling, RetiringScientistsStayWithinRoles)
+{
+	for (int i = 0; i < 1000; ++i)
+	{
+		EXPECT_EQ(0, drawRetiringScientists({0, 0, 50, 0, 0}, 50));
+		EXPECT_EQ(50, drawRetiringScientists({0, 0, 0, 50, 0}, 50));
+
+		const auto scientists = drawRetiringScientists({0, 0, 10, 5, 0}, 12);
+		EXPECT_GE(scientists, 2);
+		EXPECT_LE(scientists, 5);
+	}
+
+	EXPECT_THROW(drawRetiringScientists({0, 0, 1, 1, 0}, 3), std::runtime_error);
+}
+
+
+TEST(PopulationSampling, RetiringScientistsFollowRetireChance)
+{
+	// Each retiree is a scientist 46 out of 101 times
+	const int retirees = 100000;
+	const auto scientists = drawRetiringScientists({0, 0, retirees, retirees, 0}, retirees);
+	EXPECT_NEAR(46.0 / 101.0, static_cast<double>(scientists) / retirees, 0.01);
+}
+
+
+TEST(PopulationSampling, StarvationKillsEvenlyAtLargePopulations)
+{
+	for (const auto populationSize : {100000, 1000000})
+	{
+		const auto perRole = populationSize / 5;
+		Population population;
+		population.addPopulation({perRole, perRole, perRole, perRole, perRole});
+		population.update(600, 0, 0, 0, 0, 0);
+
+		const auto& remaining = population.getPopulations();
+		EXPECT_GE(population.deathCount(), populationSize / 2);
+		EXPECT_LE(remaining.size(), populationSize / 2);
+		EXPECT_EQ(populationSize, remaining.size() + population.deathCount() - population.birthCount());
+	}
+}
@@ -0,0 +1,133 @@
+#include <libOPHD/TimerWheel.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+TEST(TimerWheel, DispatchesOnScheduledTick)
+{
+	TimerWheel<int> wheel;
+	wheel.schedule(1, 10);
+	wheel.schedule(3, 30);
+	wheel.schedule(3, 31);
+	EXPECT_EQ(3u, wheel.size());
+
+	std::vector<int> dispatched;
+	const auto record = [&dispatched](int event) { dispatched.push_back(event); };
+
+	wheel.advance(record);
+	EXPECT_EQ((std::vector<int>{10}), dispatched);
+
+	wheel.advance(record);
+	EXPECT_EQ((std::vector<int>{10}), dispatched);
+
+	wheel.advance(record);
+	EXPECT_EQ((std::vector<int>{10, 30, 31}), dispatched);
+	EXPECT_TRUE(wheel.empty());
+}
+
+
+TEST(TimerWheel, PastTicksDispatchOnNextAdvance)
+{
+	TimerWheel<int> wheel{100};
+	wheel.schedule(50, 1);
+	wheel.schedule(100, 2);
+
+	int dispatched = 0;
+	wheel.advance([&dispatched](int) { ++dispatched; });
+	EXPECT_EQ(2, dispatched);
+	EXPECT_EQ(101u, wheel.tick());
+}
+
+
+TEST(TimerWheel, DispatchedEventCanReschedule)
+{
+	TimerWheel<int> wheel;
+	wheel.schedule(1, 0);
+
+	std::vector<std::uint64_t> ticks;
+	for (int i = 0; i < 10; ++i)
+	{
+		wheel.advance([&](int) {
+			ticks.push_back(wheel.tick());
+			wheel.schedule(wheel.tick() + 3, 0);
+		});
+	}
+	EXPECT_EQ((std::vector<std::uint64_t>{1, 4, 7, 10}), ticks);
+}
+
+
+TEST(TimerWheel, FarEventsCascadeToTheirTick)
+{
+	// Covers every level and the overflow list
+	const std::uint64_t start = (std::uint64_t{1} << 24) - 70;
+	const std::uint64_t delays[]{1, 63, 64, 65, 4095, 4096, 4097, 262143, 262144, (std::uint64_t{1} << 24) + 7};
+
+	TimerWheel<std::uint64_t> wheel{start};
+	for (const auto delay : delays)
+	{
+		wheel.schedule(start + delay, start + delay);
+	}
+
+	std::size_t dispatched = 0;
+	const auto last = start + delays[std::size(delays) - 1];
+	while (wheel.tick() < last)
+	{
+		wheel.advance([&](std::uint64_t tick) {
+			EXPECT_EQ(tick, wheel.tick());
+			++dispatched;
+		});
+	}
+	EXPECT_EQ(std::size(delays), dispatched);
+	EXPECT_TRUE(wheel.empty());
+}
+
+
+TEST(TimerWheel, RandomScheduleMatchesTicks)
+{
+	std::mt19937 generator{1234};
+	std::uniform_int_distribution<std::uint64_t> delay{1, 20000};
+
+	TimerWheel<std::uint64_t> wheel{77};
+	for (int i = 0; i < 5000; ++i)
+	{
+		const auto tick = wheel.tick() + delay(generator);
+		wheel.schedule(tick, tick);
+	}
+
+	std::size_t dispatched = 0;
+	while (!wheel.empty())
+	{
+		wheel.advance([&](std::uint64_t tick) {
+			EXPECT_EQ(tick, wheel.tick());
+			++dispatched;
+		});
+	}
+	EXPECT_EQ(5000u, dispatched);
+}
+
+
+TEST(TimerWheel, CancelIf)
+{
+	TimerWheel<int> wheel;
+	for (int i = 1; i <= 200; ++i)
+	{
+		wheel.schedule(static_cast<std::uint64_t>(i * 37), i);
+	}
+
+	wheel.cancelIf([](int event) { return event % 2 == 0; });
+	EXPECT_EQ(100u, wheel.size());
+
+	int dispatched = 0;
+	while (!wheel.empty())
+	{
+		wheel.advance([&dispatched](int event) {
+			EXPECT_EQ(1, event % 2);
+			++dispatched;
+		});
+	}
+	EXPECT_EQ(100, dispatched);
+}